@@ -16,7 +16,11 @@ class  G4HepEmGammaManager;
 
 class  G4HepEmRandomEngine;
 
+#include "G4HepEmCounters.hh"
+
 #include <vector>
+#include <map>
+#include <mutex>
 
 
 /**
@@ -89,10 +93,104 @@ public:
 
  //  void SetHepEmData(struct G4HepEmData* hepEmData) { fTheG4HepEmData; }
 
+  /**
+   * Sets the layout of the gamma macroscopic cross section tables (see
+   * G4HepEmParameters::fGammaXSecTableLayout) and the number of bins per decade
+   * of the fused table. Used (by the master-RM) at the next global initialisation.
+   */
+  void SetGammaXSecTableLayout(int layout, int numBinsPerDecade = 32) {
+    fGammaXSecTableLayout            = layout;
+    fNumGammaFusedTableBinsPerDecade = numBinsPerDecade;
+  }
+
+  /**
+   * Sets if the tabulated (default) or the analytic LPM suppression functions
+   * are used in conversion (see G4HepEmParameters::fUseLPMFunctionTables). Used
+   * (by the master-RM) at the next global initialisation.
+   */
+  void SetUseLPMFunctionTables(bool val) { fUseLPMFunctionTables = val; }
+
+  /**
+   * Sets if single precision copies of the run-time tables are built and used
+   * (see G4HepEmParameters::fUseFloat32Tables). Used (by the master-RM) at the
+   * next global initialisation.
+   */
+  void SetUseFloat32Tables(bool val) { fUseFloat32Tables = val; }
+
+  /**
+   * Sets if the tabulated Urban msc angular distributions are built and used
+   * instead of the analytic sampling (see G4HepEmParameters::fUseUMSCAngularTables).
+   * Used (by the master-RM) at the next global initialisation.
+   */
+  void SetUseUMSCAngularTables(bool val) { fUseUMSCAngularTables = val; }
+
+  /**
+   * Sets if the tabulated, energy dependent Urban msc minimum step limit and e+
+   * theta0 correction factors are built and used instead of their analytic
+   * evaluation (see G4HepEmParameters::fUseUMSCCorrectionTables).
+   * Used (by the master-RM) at the next global initialisation.
+   */
+  void SetUseUMSCCorrectionTables(bool val) { fUseUMSCCorrectionTables = val; }
+
+  /**
+   * Sets if the tabulated rejection envelopes of the relativistic brem energy
+   * transfer sampling are built and used (see G4HepEmParameters::fUseRBBremEnvelopeTables).
+   * The analytic rejection (i.e. without the envelopes) is used by default.
+   * Used (by the master-RM) at the next global initialisation.
+   */
+  void SetUseRBBremEnvelopeTables(bool val) { fUseRBBremEnvelopeTables = val; }
+
+  /**
+   * Sets if the inverse CDF tables of the Moller/Bhabha energy transfer are built
+   * and used instead of the rejection sampling (see G4HepEmParameters::fUseIoniInvCDFTables).
+   * Used (by the master-RM) at the next global initialisation.
+   */
+  void SetUseIoniInvCDFTables(bool val) { fUseIoniInvCDFTables = val; }
+
+  /**
+   * Sets if the inverse CDF tables of the Klein-Nishina reduced photon energy are
+   * built and used in Compton scattering instead of the rejection sampling (see
+   * G4HepEmParameters::fUseCompInvCDFTables). Used (by the master-RM) at the
+   * next global initialisation.
+   */
+  void SetUseCompInvCDFTables(bool val) { fUseCompInvCDFTables = val; }
+
+  /**
+   * Sets if the workers use node local replicas of the large, read-only run-time
+   * tables instead of the single master copy (see `MakeG4HepEmDataReplica`):
+   * one replica per NUMA node is built by the first worker running on that node
+   * (so the worker threads should be pinned to their CPUs) and the others on the
+   * same node share it. With `useHugePages` the replicated arrays are backed by
+   * transparent huge pages. Hugepages alone (without NUMA replication) results
+   * in a single, hugepage backed replica shared by all workers. Used (by the
+   * workers) at their initialisation, so it needs to be set on the master-RM.
+   */
+  void SetNumaReplication(bool val, bool useHugePages = true) {
+    fUseNumaReplicas = val;
+    fUseHugePages    = useHugePages;
+  }
+  void SetUseHugePages(bool val) { fUseHugePages = val; }
+
   struct G4HepEmData*       GetHepEmData()         const  { return fTheG4HepEmData; }
   struct G4HepEmParameters* GetHepEmParameters()   const  { return fTheG4HepEmParameters; }
   G4HepEmTLData*            GetTheTLData()         const  { return fTheG4HepEmTLData; }
 
+#ifdef G4HepEm_COUNTERS
+  /**
+   * Reports the run-time counters (only in builds with `G4HepEm_COUNTERS`, see
+   * G4HepEmCounters) of all workers. Invoked on the master-RM when the workers
+   * are idle (e.g. at the end of the run).
+   *
+   * Each run-manager registers its G4HepEmTLData, that stores its counters, at
+   * the master-RM in its Initialize() and the master accumulates its counts when
+   * it's cleared. The report is the sum of the accumulated and the currently
+   * registered counters.
+   */
+  void ReportCounters();
+  /** Sets all the accumulated and registered counters to zero (master-RM).*/
+  void ResetCounters();
+#endif
+
 private:
 
   /**
@@ -106,6 +204,21 @@ private:
    */
   void InitializeGlobal ();
 
+  /**
+   * Returns the replica of the master data for the NUMA node of the calling
+   * (worker) thread (or the single, shared one if the NUMA replication is not
+   * active) by building it in the first call on the given node. Invoked on the
+   * master-RM by the workers. Returns the master data if replicas cannot be
+   * made (AD builds).
+   */
+  struct G4HepEmData* GetHepEmDataReplica ();
+
+#ifdef G4HepEm_COUNTERS
+  /** Registers/deregisters the worker local data with its counters (master-RM).*/
+  void RegisterTLData (G4HepEmTLData* tlData);
+  void DeregisterTLData (G4HepEmTLData* tlData);
+#endif
+
 
 
 
@@ -122,6 +235,16 @@ private:
    * Collection of configuration parameters used at initialization and run time.
    */
   struct G4HepEmParameters*      fTheG4HepEmParameters;
+  /** Gamma macroscopic cross section table configuration set in the parameters.*/
+  int                            fGammaXSecTableLayout;
+  int                            fNumGammaFusedTableBinsPerDecade;
+  bool                           fUseLPMFunctionTables;
+  bool                           fUseFloat32Tables;
+  bool                           fUseUMSCAngularTables;
+  bool                           fUseUMSCCorrectionTables;
+  bool                           fUseRBBremEnvelopeTables;
+  bool                           fUseIoniInvCDFTables;
+  bool                           fUseCompInvCDFTables;
   /*
    * The top level data structure that stores all the data used by all processes
    * (e.g. material or material cuts couple related data, etc.)
@@ -129,6 +252,15 @@ private:
    * Initialize() method
    */
   struct G4HepEmData*            fTheG4HepEmData;
+  /*
+   * Optional replicas of the above fTheG4HepEmData (the large, read-only
+   * run-time tables) used by the workers: one per NUMA node (key) or a single
+   * one (key 0) if only the hugepages are required. Owned by the Master-RM.
+   */
+  bool                           fUseNumaReplicas;
+  bool                           fUseHugePages;
+  std::map<int, struct G4HepEmData*> fTheG4HepEmDataReplicas;
+  std::mutex                     fReplicaMutex;
 
   /*
    * Processes for e-/e+: this is the top level object to all e-/e+ related
@@ -141,6 +273,16 @@ private:
 
   G4HepEmTLData*                 fTheG4HepEmTLData;
 
+#ifdef G4HepEm_COUNTERS
+  /*
+   * Run-time counters: the registered worker local data (with the counters)
+   * and the counts of the already cleared ones. Used only by the Master-RM.
+   */
+  std::vector<G4HepEmTLData*>    fRegisteredTLData;
+  G4HepEmCounters                fAccumulatedCounters;
+  std::mutex                     fCountersMutex;
+#endif
+
 
 };
 
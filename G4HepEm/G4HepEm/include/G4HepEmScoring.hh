@@ -0,0 +1,122 @@
+#include "ad_type.h"
+#ifndef G4HepEmScoring_HH
+#define G4HepEmScoring_HH
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class G4LogicalVolume;
+
+/**
+ * @file    G4HepEmScoring.hh
+ * @class   G4HepEmScoring
+ *
+ * Lightweight energy deposit and track length scoring with per-thread
+ * accumulation.
+ *
+ * A single (shared) instance is constructed with the number of volume IDs to
+ * score (volume IDs are in [0, numVolumeIDs)). The volume IDs are assigned by
+ * the user to the (logical volume, copy number) pairs of the scoring volumes
+ * through `SetVolumeIDs()` before the run: the copy number alone is ambiguous
+ * as different logical volumes can have the same copy numbers.
+ *
+ * Each worker obtains its own `G4HepEmScoring::Buffer` through
+ * `CreateThreadBuffer()` and accumulates into that buffer without any
+ * synchronisation during the run. This is typically done by connecting the
+ * buffer to the scoring callback of the `G4HepEmTrackingManager` (see its
+ * `SetScoring` method) so the per-step values are taken directly from the
+ * G4HepEm tracks without the need of any user stepping action.
+ *
+ * At the end of the run, when all workers are idle, the master calls `Merge()`
+ * to sum up the thread local buffers (that are reset) into the final results.
+ * Both `CreateThreadBuffer()` and `Merge()` take a lock but none of them is
+ * called during the event processing.
+ */
+
+class G4HepEmScoring {
+public:
+  class Buffer {
+  public:
+    Buffer(int numVolumeIDs)
+      : fEdep(numVolumeIDs, 0.), fChargedTrackLength(numVolumeIDs, 0.),
+        fNumChargedSteps(numVolumeIDs, 0), fNumNeutralSteps(numVolumeIDs, 0) {}
+
+    // Accumulates the per-step quantities: steps with volume IDs out of the
+    // [0, numVolumeIDs) range are ignored.
+    void Accumulate(int volumeID, G4double edep, G4double stepLength, G4double charge) {
+      if (volumeID < 0 || volumeID >= (int)fEdep.size()) {
+        return;
+      }
+      fEdep[volumeID] += edep;
+      if (charge != 0.0) {
+        fChargedTrackLength[volumeID] += stepLength;
+        ++fNumChargedSteps[volumeID];
+      } else {
+        ++fNumNeutralSteps[volumeID];
+      }
+    }
+
+    void Reset() {
+      for (std::size_t i = 0; i < fEdep.size(); ++i) {
+        fEdep[i]               = 0.;
+        fChargedTrackLength[i] = 0.;
+        fNumChargedSteps[i]    = 0;
+        fNumNeutralSteps[i]    = 0;
+      }
+    }
+
+    std::vector<G4double>  fEdep;
+    std::vector<G4double>  fChargedTrackLength;
+    std::vector<long>      fNumChargedSteps;
+    std::vector<long>      fNumNeutralSteps;
+  };
+
+  G4HepEmScoring(int numVolumeIDs);
+ ~G4HepEmScoring();
+
+  // Assigns the volume IDs [firstVolumeID, firstVolumeID + numCopies) to the
+  // copy numbers [0, numCopies) of the given logical volume (e.g. the replicas
+  // of a layer). Must be called before the run (the look-up is not locked).
+  void SetVolumeIDs(const G4LogicalVolume* logicalVolume, int firstVolumeID, int numCopies = 1) {
+    fVolumeIDs[logicalVolume] = std::make_pair(firstVolumeID, numCopies);
+  }
+
+  // The volume ID of the given (logical volume, copy number) pair or -1 if it
+  // has not been assigned (i.e. it is not scored).
+  int GetVolumeID(const G4LogicalVolume* logicalVolume, int copyNumber) const {
+    auto it = fVolumeIDs.find(logicalVolume);
+    if (it == fVolumeIDs.end() || copyNumber < 0 || copyNumber >= it->second.second) {
+      return -1;
+    }
+    return it->second.first + copyNumber;
+  }
+
+  // Creates a new buffer for the calling thread (owned by this object).
+  Buffer* CreateThreadBuffer();
+
+  // Sums up the thread local buffers into the results and resets them. Must be
+  // called when no accumulation happens (e.g. in the master end of run action).
+  void Merge();
+
+  // Resets the merged results.
+  void Reset() { fResult.Reset(); }
+
+  int GetNumVolumeIDs() const { return fNumVolumeIDs; }
+  const std::vector<G4double>& GetEdep() const { return fResult.fEdep; }
+  const std::vector<G4double>& GetChargedTrackLength() const { return fResult.fChargedTrackLength; }
+  const std::vector<long>&     GetNumChargedSteps() const { return fResult.fNumChargedSteps; }
+  const std::vector<long>&     GetNumNeutralSteps() const { return fResult.fNumNeutralSteps; }
+
+private:
+  int                   fNumVolumeIDs;
+  Buffer                fResult;
+  std::vector<Buffer*>  fThreadBuffers;
+  // the (first volume ID, number of copies) of the scored logical volumes
+  std::unordered_map<const G4LogicalVolume*, std::pair<int, int>> fVolumeIDs;
+  std::mutex            fMutex;
+};
+
+#endif // G4HepEmScoring_HH
@@ -4,13 +4,22 @@
 
 #include "G4VTrackingManager.hh"
 #include "globals.hh"
+#include "G4TouchableHandle.hh"
+#include "G4TrackVector.hh"
 
 class G4HepEmRunManager;
 class G4HepEmRandomEngine;
 class G4HepEmNoProcess;
+class G4HepEmScoring;
+class G4HepEmTLData;
+class G4HepEmWoodcockHelper;
+class G4LogicalVolume;
 class G4SafetyHelper;
 class G4Step;
+class G4StepPoint;
+class G4VProcess;
 
+#include <functional>
 #include <vector>
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -33,10 +42,163 @@ public:
     return fMultipleSteps;
   }
 
+  // Do the e-/e+ sub-steps limited by MSC (when multiple steps are enabled)
+  // without any navigator calls as long as they stay inside the safety sphere
+  // computed at the pre-step point and there is no field in the volume: the
+  // particle is moved along straight lines and the navigator (and the G4 track
+  // touchable) is synchronised only at the last sub-step i.e. when the safety
+  // is exhausted or at the discrete interaction. Disabled by default.
+  void SetMultipleStepsInSafety(G4bool val) {
+    fMultipleStepsInSafety = val;
+  }
+  G4bool MultipleStepsInSafety() const {
+    return fMultipleStepsInSafety;
+  }
+
+  // Use a lean e-/e+ stepping loop when there is no user stepping action
+  // (checked at each track) and for the steps in volumes without regional
+  // stepping action and sensitive detector (checked at each step): the G4Step
+  // is then updated only as much as required by the navigation (no energy
+  // deposit, pre-step material, track length update, etc. per step). Enabled
+  // by default.
+  void SetLeanStepping(G4bool val) {
+    fLeanStepping = val;
+  }
+  G4bool LeanStepping() const {
+    return fLeanStepping;
+  }
+
+  // Issue software prefetch hints for the e-/e+ table rows used by the post-step
+  // physics (energy loss and the winner discrete interaction) before each
+  // geometry step so they are loaded while navigating. Disabled by default
+  // (the gain has not been measured yet, see TestEm3/benchmark_prefetch.sh).
+  void SetPrefetchTables(G4bool val) {
+    fPrefetchTables = val;
+  }
+  G4bool PrefetchTables() const {
+    return fPrefetchTables;
+  }
+
+  // Use the fused gamma macroscopic cross section table (layout 1) instead of
+  // the separate conversion, Compton and photoelectric ones (layout 0, default)
+  // with the given number of bins per decade. Must be set before the run is
+  // initialised (see G4HepEmParameters::fGammaXSecTableLayout).
+  void SetGammaXSecTableLayout(G4int layout, G4int numBinsPerDecade = 32);
+
+  // Use the tabulated (default) or the analytic (e.g. for validation) LPM
+  // suppression functions in conversion. Must be set before the run is
+  // initialised (see G4HepEmParameters::fUseLPMFunctionTables).
+  void SetUseLPMFunctionTables(G4bool val);
+
+  // Use single precision copies of the energy loss, macroscopic cross section
+  // and element selector tables at run-time (double by default). Must be set
+  // before the run is initialised (see G4HepEmParameters::fUseFloat32Tables).
+  void SetUseFloat32Tables(G4bool val);
+
+  // Use the tabulated Urban msc angular distributions instead of the analytic
+  // sampling (default). Must be set before the run is initialised (see
+  // G4HepEmParameters::fUseUMSCAngularTables).
+  void SetUseUMSCAngularTables(G4bool val);
+
+  // Use the tabulated Urban msc minimum step limit and e+ theta0 correction
+  // factors instead of their analytic evaluation (default). Must be set before
+  // the run is initialised (see G4HepEmParameters::fUseUMSCCorrectionTables).
+  void SetUseUMSCCorrectionTables(G4bool val);
+
+  // Use the tabulated rejection envelopes in the relativistic brem energy
+  // transfer sampling instead of the analytic rejection (default).
+  // Must be set before the run is initialised (see
+  // G4HepEmParameters::fUseRBBremEnvelopeTables).
+  void SetUseRBBremEnvelopeTables(G4bool val);
+
+  // Use the tabulated inverse CDF of the Moller/Bhabha energy transfer instead
+  // of the rejection sampling (default). Must be set before the run is
+  // initialised (see G4HepEmParameters::fUseIoniInvCDFTables).
+  void SetUseIoniInvCDFTables(G4bool val);
+
+  // Use the tabulated inverse CDF of the Klein-Nishina reduced photon energy in
+  // Compton scattering instead of the rejection sampling (default). Must be set
+  // before the run is initialised (see G4HepEmParameters::fUseCompInvCDFTables).
+  void SetUseCompInvCDFTables(G4bool val);
+
+  // Use replicas of the large, read-only run-time tables local to the NUMA node
+  // of each worker (threads should be pinned) and/or back them by transparent
+  // huge pages (see G4HepEmRunManager::SetNumaReplication). Must be set before
+  // the run is initialised.
+  void SetNumaReplication(G4bool val, G4bool useHugePages = true);
+
+  // Keep the e-/e+/gamma secondaries in an internal stack of this tracking
+  // manager and track them right after their parent instead of handing them
+  // back to the Geant4 stack (that would give them back to this tracking
+  // manager anyway). Only secondaries with kinetic energy below the energy
+  // limit are kept (no limit by default i.e. the full shower is kept).
+  // The Geant4 stack is used when a user stacking action is present or
+  // trajectories are stored since they need to see all tracks.
+  // NOTE: track IDs of the locally stacked tracks are assigned by this
+  //       tracking manager, starting from `kLocalStackFirstTrackID` in each
+  //       event, as the Geant4 track ID counter is not accessible.
+  void SetLocalSecondaryStack(G4bool val) {
+    fLocalSecondaryStack = val;
+  }
+  G4bool LocalSecondaryStack() const {
+    return fLocalSecondaryStack;
+  }
+  void SetLocalStackEnergyLimit(G4double val) {
+    fLocalStackEnergyLimit = val;
+  }
+  G4double LocalStackEnergyLimit() const {
+    return fLocalStackEnergyLimit;
+  }
+
+  static constexpr G4int kLocalStackFirstTrackID = 1000000000;
+
+  // Gammas are tracked by using Woodcock (delta) tracking inside the root
+  // logical volume(s) of the given region: the geometry boundaries inside are
+  // ignored and the distance to the next interaction is sampled by using the
+  // majorant cross section of the region (see G4HepEmWoodcockHelper).
+  void AddWoodcockTrackingRegion(const G4String &regionName) {
+    fWDTRegionNames.push_back(regionName);
+  }
+
+  // Optional scoring callback invoked at the end of each e-/e+ step and each
+  // gamma step (that ends with an interaction or on a boundary) with the
+  // logical volume and copy number of the (pre-step point) volume, the energy
+  // deposit, the (true) step length and the charge of the particle. The values
+  // are taken directly from the G4HepEm track state so scoring doesn't need
+  // any user stepping action.
+  using ScoringCallback =
+      std::function<void(const G4LogicalVolume *logicalVolume, G4int copyNumber,
+                         G4double edep, G4double stepLength, G4double charge)>;
+  void SetScoringCallback(const ScoringCallback &callback) {
+    fScoringCallback = callback;
+  }
+  // Connects a new, thread local buffer of the given (shared) scoring object
+  // to the scoring callback (the volume IDs are taken from the scoring object).
+  void SetScoring(G4HepEmScoring *scoring);
+
 private:
+  void TrackOneTrack(G4Track *aTrack);
   void TrackElectron(G4Track *aTrack);
   void TrackGamma(G4Track *aTrack);
 
+  // Converts all secondaries, produced by G4HepEm in the last step and stored
+  // in the `G4HepEmTLData` buffers, to `G4Track`-s in one go and appends them
+  // to `secondaries`. Returns the energy deposit from the secondaries that were
+  // killed by applying the production cuts (if `applyCuts`). The secondary
+  // buffers of `G4HepEmTLData` are reset.
+  G4double StackSecondaries(G4HepEmTLData *theTLData, const G4Track *aTrack,
+                            const G4VProcess *proc, int g4IMC,
+                            const G4StepPoint &postStepPoint,
+                            const G4TouchableHandle &touchableHandle,
+                            G4TrackVector &secondaries);
+
+  // Moves the secondaries that can be tracked locally from `secondaries` to
+  // the internal track stack (if enabled). The rest is left in `secondaries`.
+  void PushToLocalStack(G4TrackVector &secondaries);
+
+  // Invokes the scoring callback (if any) for the given step.
+  void ScoreStep(const G4Step &step, G4double edep, G4double charge) const;
+
   G4HepEmRunManager *fRunManager;
   G4HepEmRandomEngine *fRandomEngine;
   G4SafetyHelper *fSafetyHelper;
@@ -47,6 +209,20 @@ private:
   const std::vector<G4double> *theCutsPositron = nullptr;
   G4bool applyCuts = false;
   G4bool fMultipleSteps = true;
+  G4bool fMultipleStepsInSafety = false;
+  G4bool fLeanStepping = true;
+  G4bool fPrefetchTables = false;
+
+  G4bool fLocalSecondaryStack = false;
+  G4double fLocalStackEnergyLimit = DBL_MAX;
+  G4int fLocalStackEventID = -1;
+  G4int fLocalStackTrackID = kLocalStackFirstTrackID;
+  std::vector<G4Track *> fLocalTrackStack;
+
+  std::vector<G4String> fWDTRegionNames;
+  G4HepEmWoodcockHelper *fWoodcockHelper = nullptr;
+
+  ScoringCallback fScoringCallback;
 
   // A set of empty processes with the correct names and types just to be able
   // to set them as process limiting the step and creating secondaries as some
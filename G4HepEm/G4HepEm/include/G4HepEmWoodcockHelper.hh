@@ -0,0 +1,121 @@
+#include "ad_type.h"
+#ifndef G4HepEmWoodcockHelper_h
+#define G4HepEmWoodcockHelper_h 1
+
+#include "globals.hh"
+#include "G4LogicalVolume.hh"
+#include "G4ThreeVector.hh"
+
+#include <vector>
+
+struct G4HepEmData;
+
+class G4Region;
+class G4VTouchable;
+
+/**
+ * @file    G4HepEmWoodcockHelper.hh
+ * @class   G4HepEmWoodcockHelper
+ *
+ * @brief Auxiliary data and methods for Woodcock (delta) tracking of gammas.
+ *
+ * Gammas can be tracked by using Woodcock tracking inside the root logical
+ * volume(s) of the selected detector regions. The majorant, i.e. the maximum
+ * of the total macroscopic cross section over all materials that can be found
+ * inside the root logical volume(s) of a given region (including all daughter
+ * volumes), is tabulated over the G4HepEm Compton energy grid. The distance to
+ * the next interaction is sampled from this majorant macroscopic cross section
+ * while the geometry boundaries inside the root volume are ignored. An
+ * interaction, sampled this way, is accepted as real with the probability of
+ * the ratio of the actual total and the majorant macroscopic cross sections at
+ * the post-interaction point (fictitious interaction otherwise).
+ *
+ * The majorant is stored as a step function: the value of a bin is the
+ * maximum of the total macroscopic cross section within the energy bin
+ * (including the photoelectric absorption edges inside the bin) times a small
+ * safety factor. The total macroscopic cross section is computed by the same
+ * table lookup as at run time (`G4HepEmGammaManager::GetMacXSecs`, i.e. from
+ * the fused or the single precision tables when these are used). Violations of
+ * the majorant found at run time are counted and reported.
+ */
+
+class G4HepEmWoodcockHelper {
+public:
+  G4HepEmWoodcockHelper();
+  ~G4HepEmWoodcockHelper();
+
+  // Builds the majorant macroscopic cross section tables for the regions given
+  // by their names. Regions that cannot be found are ignored (with a warning).
+  // Must be called after the G4HepEmData and the G4 material-cuts couples have
+  // been initialised.
+  void Initialize(const std::vector<G4String> &regionNames,
+                  struct G4HepEmData *hepEmData);
+
+  // Index of the Woodcock tracking region of the given logical volume or -1 if
+  // the volume is not in any of the Woodcock tracking regions.
+  G4int GetRegionIndex(const G4LogicalVolume *lvol) const {
+    if (fRegions.empty()) {
+      return -1;
+    }
+    for (std::size_t ir = 0; ir < fRegions.size(); ++ir) {
+      if (fRegions[ir].fRegion == lvol->GetRegion()) {
+        return (G4int)ir;
+      }
+    }
+    return -1;
+  }
+
+  // The majorant macroscopic cross section in the given Woodcock tracking
+  // region at the given gamma energy. Returns a negative value if the energy
+  // is outside of the tabulated range (Woodcock tracking is not used then).
+  G4double GetMajorantMacXSec(G4int iregion, G4double ekin,
+                              G4double lekin) const;
+
+  // Records that the actual total macroscopic cross section at an interaction
+  // point was found to be larger than the majorant. The interaction is then
+  // accepted as real, i.e. the acceptance probability is clamped to 1, by the
+  // caller. The first violation is reported with a warning while their number
+  // is reported at destruction.
+  void CountMajorantViolation(G4double ekin, G4double totalMacXSec,
+                              G4double majorant);
+
+  long GetNumMajorantViolations() const { return fNumMajorantViolations; }
+
+  // Distance, along the given direction, from the given global position to the
+  // boundary of the root logical volume of the Woodcock tracking region. The
+  // root volume is searched upwards in the geometry hierarchy of the touchable
+  // that must be the one at the given position.
+  G4double ComputeDistanceToRootExit(G4int iregion,
+                                     const G4VTouchable *touchable,
+                                     const G4ThreeVector &pos,
+                                     const G4ThreeVector &dir) const;
+
+private:
+  struct WDTRegionData {
+    const G4Region *fRegion;
+    std::vector<G4double> fMajorantMacXSec;
+  };
+
+  // Majorant over all material-cuts couples (given by their G4 indices) for the
+  // energy bin `ibin` of the Compton energy grid.
+  G4double ComputeMajorant(const std::vector<G4int> &g4MCIndices, G4int ibin,
+                           struct G4HepEmData *hepEmData) const;
+
+  // Collects the G4 material-cuts couple indices of the logical volume and all
+  // its daughters (recursively).
+  void CollectCoupleIndices(const G4LogicalVolume *lvol,
+                            std::vector<const G4LogicalVolume *> &visited,
+                            std::vector<G4int> &g4MCIndices) const;
+
+  std::vector<WDTRegionData> fRegions;
+  // The energy grid of the majorant tables (same as the Compton energy grid).
+  G4int fNumEnergyBins;
+  G4double fMinEnergy;
+  G4double fMaxEnergy;
+  G4double fLogMinEnergy;
+  G4double fInvLogDelta;
+  // Number of interaction points where the majorant was found to be violated.
+  long fNumMajorantViolations;
+};
+
+#endif
@@ -20,6 +20,27 @@
 #include "G4HepEmRandomEngine.hh"
 
 #include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+  // NUMA node of the CPU the calling thread runs on (0 if not available)
+  int GetCurrentNumaNode() {
+#if defined(__linux__) && defined(SYS_getcpu)
+    unsigned int cpu  = 0;
+    unsigned int node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+      return static_cast<int>(node);
+    }
+#endif
+    return 0;
+  }
+}
 
 
 G4HepEmRunManager* G4HepEmRunManager::gTheG4HepEmRunManagerMaster = nullptr;
@@ -38,6 +59,17 @@ G4HepEmRunManager::G4HepEmRunManager(bool ismaster) {
   fTheG4HepEmParameters          = nullptr;
   fTheG4HepEmData                = nullptr;
   fTheG4HepEmTLData              = nullptr;
+  fGammaXSecTableLayout             = 0;
+  fNumGammaFusedTableBinsPerDecade  = 32;
+  fUseLPMFunctionTables             = true;
+  fUseFloat32Tables                 = false;
+  fUseUMSCAngularTables             = false;
+  fUseUMSCCorrectionTables          = false;
+  fUseRBBremEnvelopeTables          = false;
+  fUseIoniInvCDFTables              = false;
+  fUseCompInvCDFTables              = false;
+  fUseNumaReplicas                  = false;
+  fUseHugePages                     = false;
 }
 
 
@@ -68,6 +100,15 @@ void G4HepEmRunManager::InitializeGlobal() {
     //     initialization of all configuartion parameters by extracting information
     //     from the G4EmParameters.
     InitHepEmParameters(fTheG4HepEmParameters);
+    fTheG4HepEmParameters->fGammaXSecTableLayout            = fGammaXSecTableLayout;
+    fTheG4HepEmParameters->fNumGammaFusedTableBinsPerDecade = fNumGammaFusedTableBinsPerDecade;
+    fTheG4HepEmParameters->fUseLPMFunctionTables            = fUseLPMFunctionTables;
+    fTheG4HepEmParameters->fUseFloat32Tables                = fUseFloat32Tables;
+    fTheG4HepEmParameters->fUseUMSCAngularTables            = fUseUMSCAngularTables;
+    fTheG4HepEmParameters->fUseUMSCCorrectionTables         = fUseUMSCCorrectionTables;
+    fTheG4HepEmParameters->fUseRBBremEnvelopeTables         = fUseRBBremEnvelopeTables;
+    fTheG4HepEmParameters->fUseIoniInvCDFTables             = fUseIoniInvCDFTables;
+    fTheG4HepEmParameters->fUseCompInvCDFTables             = fUseCompInvCDFTables;
 
     // === Use the G4HepEmMaterialInit::InitMaterialAndCoupleData method for the
     //     initialization of all material and secondary production threshold related
@@ -120,20 +161,27 @@ void G4HepEmRunManager::Initialize(G4HepEmRandomEngine* theRNGEngine, int hepEmP
     if  (!fTheG4HepEmTLData) {
       fTheG4HepEmTLData = new G4HepEmTLData;
       fTheG4HepEmTLData->SetRandomEngine(theRNGEngine);
+      G4HepEmCOUNT(RegisterTLData(fTheG4HepEmTLData);)
     }
   } else {
     //
     // Worker: 1. copy the pointers to members that are shared by all workers
     //            from the master-RM if it has not been done yet.
+    //            The data might be a replica local to the NUMA node of this
+    //            worker (built by the first worker on the node).
     if (!fTheG4HepEmParameters) {
-      fTheG4HepEmParameters = G4HepEmRunManager::GetMasterRunManager()->GetHepEmParameters();
-      fTheG4HepEmData       = G4HepEmRunManager::GetMasterRunManager()->GetHepEmData();
+      G4HepEmRunManager* masterRM = G4HepEmRunManager::GetMasterRunManager();
+      fTheG4HepEmParameters = masterRM->GetHepEmParameters();
+      fTheG4HepEmData       = (masterRM->fUseNumaReplicas || masterRM->fUseHugePages)
+                              ? masterRM->GetHepEmDataReplica()
+                              : masterRM->GetHepEmData();
     }
     // Worker: 2. create a worker local data structure for this worker and set
     //            its RNG engine part if it has not been done yet.
     if  (!fTheG4HepEmTLData) {
       fTheG4HepEmTLData = new G4HepEmTLData;
       fTheG4HepEmTLData->SetRandomEngine(theRNGEngine);
+      G4HepEmCOUNT(G4HepEmRunManager::GetMasterRunManager()->RegisterTLData(fTheG4HepEmTLData);)
     }
   }
 }
@@ -146,6 +194,11 @@ void G4HepEmRunManager::Clear() {
       delete fTheG4HepEmParameters;
       fTheG4HepEmParameters = nullptr;
     }
+    // the replicas share parts of the master data so they are freed first
+    for (auto& replica : fTheG4HepEmDataReplicas) {
+      FreeG4HepEmDataReplica(&(replica.second));
+    }
+    fTheG4HepEmDataReplicas.clear();
     if (fTheG4HepEmData) {
       FreeG4HepEmData(fTheG4HepEmData);
       delete fTheG4HepEmData;
@@ -159,8 +212,119 @@ void G4HepEmRunManager::Clear() {
     fTheG4HepEmParameters      = nullptr;
     fTheG4HepEmData            = nullptr;
     // clean local objects and set ptr
+#ifdef G4HepEm_COUNTERS
+    // the counters are accumulated by the master
+    if (fTheG4HepEmTLData && G4HepEmRunManager::GetMasterRunManager()) {
+      G4HepEmRunManager::GetMasterRunManager()->DeregisterTLData(fTheG4HepEmTLData);
+    }
+#endif
     if (fTheG4HepEmTLData)
       delete fTheG4HepEmTLData;
     fTheG4HepEmTLData     = nullptr;
   }
 }
+
+
+G4HepEmData* G4HepEmRunManager::GetHepEmDataReplica() {
+  const int node = fUseNumaReplicas ? GetCurrentNumaNode() : 0;
+  std::lock_guard<std::mutex> lock(fReplicaMutex);
+  auto itr = fTheG4HepEmDataReplicas.find(node);
+  if (itr != fTheG4HepEmDataReplicas.end()) {
+    return itr->second;
+  }
+  // built by the calling thread: first touch places the pages on its node
+  G4HepEmData* replica = MakeG4HepEmDataReplica(fTheG4HepEmData, fUseHugePages);
+  if (replica == nullptr) {
+    return fTheG4HepEmData;
+  }
+  std::cout << " === G4HepEm data replica is built for NUMA node = " << node << std::endl;
+  fTheG4HepEmDataReplicas[node] = replica;
+  return replica;
+}
+
+
+#ifdef G4HepEm_COUNTERS
+void G4HepEmRunManager::RegisterTLData(G4HepEmTLData* tlData) {
+  std::lock_guard<std::mutex> lock(fCountersMutex);
+  fRegisteredTLData.push_back(tlData);
+}
+
+
+void G4HepEmRunManager::DeregisterTLData(G4HepEmTLData* tlData) {
+  std::lock_guard<std::mutex> lock(fCountersMutex);
+  auto itr = std::find(fRegisteredTLData.begin(), fRegisteredTLData.end(), tlData);
+  if (itr != fRegisteredTLData.end()) {
+    fAccumulatedCounters.Add(tlData->GetCounters());
+    fRegisteredTLData.erase(itr);
+  }
+}
+
+
+void G4HepEmRunManager::ReportCounters() {
+  std::lock_guard<std::mutex> lock(fCountersMutex);
+  G4HepEmCounters counters = fAccumulatedCounters;
+  for (G4HepEmTLData* tlData : fRegisteredTLData) {
+    counters.Add(tlData->GetCounters());
+  }
+  std::cout << " === G4HepEm run-time counters (" << fRegisteredTLData.size() << " registered threads): " << std::endl;
+  for (int ip=0; ip<G4HepEmCounters::kNumParticles; ++ip) {
+    const unsigned long numSteps = counters.fNumSteps[ip];
+    std::cout << "   " << std::setw(6) << std::left << G4HepEmCounters::GetParticleName(ip) << std::right
+              << " steps = " << numSteps;
+    if (ip != G4HepEmCounters::kGamma) {
+      std::cout << "  delta rejections = " << counters.fNumDeltaRejections[ip];
+    }
+    std::cout << std::endl;
+    if (numSteps == 0) {
+      continue;
+    }
+    for (int iw=0; iw<G4HepEmCounters::kNumProcesses; ++iw) {
+      const unsigned long num = counters.fNumWinnerProcess[ip][iw];
+      if (num > 0) {
+        std::cout << "      " << std::setw(16) << std::left << G4HepEmCounters::GetProcessName(iw) << std::right
+                  << std::setw(14) << num << "  (" << std::fixed << std::setprecision(2)
+                  << 100.0*num/numSteps << " %)" << std::defaultfloat << std::endl;
+      }
+    }
+  }
+  std::cout << "   rejection loops: " << std::endl;
+  for (int il=0; il<G4HepEmCounters::kNumLoops; ++il) {
+    const unsigned long numCalls = counters.fNumLoopCalls[il];
+    std::cout << "      " << std::setw(16) << std::left << G4HepEmCounters::GetLoopName(il) << std::right
+              << " calls = " << std::setw(14) << numCalls << "  iterations/call = "
+              << (numCalls > 0 ? (double)counters.fNumLoopIterations[il]/numCalls : 0.0) << std::endl;
+  }
+  if (counters.fNumRBEnvelopeViolations > 0) {
+    std::cout << "   *** RB-Brem rejection envelope violations = " << counters.fNumRBEnvelopeViolations << std::endl;
+  }
+  std::cout << "   secondaries: e-/e+ = " << counters.fNumSecondaryElectrons
+            << "  gamma = " << counters.fNumSecondaryGammas << std::endl;
+  std::cout << "   wall-clock times: " << std::endl;
+  for (int ip=0; ip<G4HepEmCounters::kNumParticles; ++ip) {
+    const unsigned long numTracks = counters.fNumTracks[ip];
+    std::cout << "   " << std::setw(6) << std::left << G4HepEmCounters::GetParticleName(ip) << std::right
+              << " tracking = " << 1.0E-9*counters.fTrackingTime[ip] << " [s]  per track = "
+              << (numTracks > 0 ? counters.fTrackingTime[ip]/numTracks : 0.0) << " [ns]  per step = "
+              << (counters.fNumSteps[ip] > 0 ? counters.fTrackingTime[ip]/counters.fNumSteps[ip] : 0.0)
+              << " [ns]" << std::endl;
+    for (int iw=0; iw<G4HepEmCounters::kNumProcesses; ++iw) {
+      const unsigned long num = counters.fNumInteractions[ip][iw];
+      if (num > 0) {
+        std::cout << "      " << std::setw(16) << std::left << G4HepEmCounters::GetProcessName(iw) << std::right
+                  << " interactions = " << std::setw(14) << num << "  time = "
+                  << 1.0E-9*counters.fInteractionTime[ip][iw] << " [s]  per interaction = "
+                  << counters.fInteractionTime[ip][iw]/num << " [ns]" << std::endl;
+      }
+    }
+  }
+}
+
+
+void G4HepEmRunManager::ResetCounters() {
+  std::lock_guard<std::mutex> lock(fCountersMutex);
+  fAccumulatedCounters.Reset();
+  for (G4HepEmTLData* tlData : fRegisteredTLData) {
+    tlData->GetCounters().Reset();
+  }
+}
+#endif
@@ -0,0 +1,35 @@
+#include "ad_type.h"
+#include "G4HepEmScoring.hh"
+
+
+G4HepEmScoring::G4HepEmScoring(int numVolumeIDs)
+  : fNumVolumeIDs(numVolumeIDs), fResult(numVolumeIDs) { }
+
+
+G4HepEmScoring::~G4HepEmScoring() {
+  for (auto* buffer : fThreadBuffers) {
+    delete buffer;
+  }
+}
+
+
+G4HepEmScoring::Buffer* G4HepEmScoring::CreateThreadBuffer() {
+  Buffer* buffer = new Buffer(fNumVolumeIDs);
+  std::lock_guard<std::mutex> lock(fMutex);
+  fThreadBuffers.push_back(buffer);
+  return buffer;
+}
+
+
+void G4HepEmScoring::Merge() {
+  std::lock_guard<std::mutex> lock(fMutex);
+  for (auto* buffer : fThreadBuffers) {
+    for (int i = 0; i < fNumVolumeIDs; ++i) {
+      fResult.fEdep[i]               += buffer->fEdep[i];
+      fResult.fChargedTrackLength[i] += buffer->fChargedTrackLength[i];
+      fResult.fNumChargedSteps[i]    += buffer->fNumChargedSteps[i];
+      fResult.fNumNeutralSteps[i]    += buffer->fNumNeutralSteps[i];
+    }
+    buffer->Reset();
+  }
+}
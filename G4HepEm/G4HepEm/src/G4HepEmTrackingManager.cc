@@ -3,10 +3,13 @@
 #include "TrackingManagerHelper.hh"
 
 #include "G4HepEmNoProcess.hh"
+#include "G4HepEmScoring.hh"
+#include "G4HepEmWoodcockHelper.hh"
 
 #include "G4HepEmRandomEngine.hh"
 #include "G4HepEmData.hh"
 #include "G4HepEmMatCutData.hh"
+#include "G4HepEmMaterialData.hh"
 #include "G4HepEmRunManager.hh"
 #include "G4HepEmTLData.hh"
 
@@ -15,14 +18,23 @@
 #include "G4HepEmPositronInteractionAnnihilation.hh"
 #include "G4HepEmGammaManager.hh"
 #include "G4HepEmGammaTrack.hh"
+#include "G4HepEmRunUtils.hh"
 
+#include "G4Event.hh"
+#include "G4EventManager.hh"
+#include "G4LogicalVolume.hh"
 #include "G4MaterialCutsCouple.hh"
+#include "G4Region.hh"
 #include "G4Step.hh"
 #include "G4StepPoint.hh"
 #include "G4StepStatus.hh"
 #include "G4Threading.hh"
 #include "G4Track.hh"
+#include "G4TrackingManager.hh"
+#include "G4VPhysicalVolume.hh"
 
+#include "G4FieldManager.hh"
+#include "G4Navigator.hh"
 #include "G4SafetyHelper.hh"
 #include "G4TransportationManager.hh"
 
@@ -37,6 +49,19 @@
 #include "G4Gamma.hh"
 #include "G4Positron.hh"
 
+#ifdef G4HepEm_COUNTERS
+#include <chrono>
+
+namespace {
+// The wall-clock time [ns] elapsed since `start` (for the run-time counters).
+double ElapsedTime(const std::chrono::steady_clock::time_point &start) {
+  return std::chrono::duration<double, std::nano>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+} // namespace
+#endif
+
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
 G4HepEmTrackingManager::G4HepEmTrackingManager() {
@@ -84,6 +109,10 @@ G4HepEmTrackingManager::~G4HepEmTrackingManager() {
   for (auto *proc : fGammaNoProcessVector) {
     delete proc;
   }
+  for (auto *track : fLocalTrackStack) {
+    delete track;
+  }
+  delete fWoodcockHelper;
   delete fRunManager;
   delete fRandomEngine;
   delete fStep;
@@ -91,6 +120,61 @@ G4HepEmTrackingManager::~G4HepEmTrackingManager() {
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
+void G4HepEmTrackingManager::SetGammaXSecTableLayout(G4int layout,
+                                                     G4int numBinsPerDecade) {
+  fRunManager->SetGammaXSecTableLayout(layout, numBinsPerDecade);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void G4HepEmTrackingManager::SetUseLPMFunctionTables(G4bool val) {
+  fRunManager->SetUseLPMFunctionTables(val);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void G4HepEmTrackingManager::SetUseFloat32Tables(G4bool val) {
+  fRunManager->SetUseFloat32Tables(val);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void G4HepEmTrackingManager::SetUseUMSCAngularTables(G4bool val) {
+  fRunManager->SetUseUMSCAngularTables(val);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void G4HepEmTrackingManager::SetUseUMSCCorrectionTables(G4bool val) {
+  fRunManager->SetUseUMSCCorrectionTables(val);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void G4HepEmTrackingManager::SetUseRBBremEnvelopeTables(G4bool val) {
+  fRunManager->SetUseRBBremEnvelopeTables(val);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void G4HepEmTrackingManager::SetUseIoniInvCDFTables(G4bool val) {
+  fRunManager->SetUseIoniInvCDFTables(val);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void G4HepEmTrackingManager::SetUseCompInvCDFTables(G4bool val) {
+  fRunManager->SetUseCompInvCDFTables(val);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void G4HepEmTrackingManager::SetNumaReplication(G4bool val, G4bool useHugePages) {
+  fRunManager->SetNumaReplication(val, useHugePages);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
 void G4HepEmTrackingManager::BuildPhysicsTable(const G4ParticleDefinition &part) {
   if (&part == G4Electron::Definition()) {
     fRunManager->Initialize(fRandomEngine, 0);
@@ -98,6 +182,12 @@ void G4HepEmTrackingManager::BuildPhysicsTable(const G4ParticleDefinition &part)
     fRunManager->Initialize(fRandomEngine, 1);
   } else if (&part == G4Gamma::Definition()) {
     fRunManager->Initialize(fRandomEngine, 2);
+    if (!fWDTRegionNames.empty()) {
+      if (fWoodcockHelper == nullptr) {
+        fWoodcockHelper = new G4HepEmWoodcockHelper;
+      }
+      fWoodcockHelper->Initialize(fWDTRegionNames, fRunManager->GetHepEmData());
+    }
   } else {
     std::cerr
         << " **** ERROR in G4HepEmProcess::BuildPhysicsTable: unknown particle "
@@ -129,6 +219,12 @@ void G4HepEmTrackingManager::TrackElectron(G4Track *aTrack) {
   auto* evtMgr             = G4EventManager::GetEventManager();
   auto* userTrackingAction = evtMgr->GetUserTrackingAction();
   auto* userSteppingAction = evtMgr->GetUserSteppingAction();
+  // Nobody looks at the G4Step at the end of the steps: skip all the step
+  // bookkeeping that is not required by the navigation and G4HepEm. Sensitive
+  // detectors and regional stepping actions are checked in each step (see
+  // below) since they can be attached at any time.
+  const bool leanStepping = fLeanStepping && userSteppingAction == nullptr;
+  G4double leanTrackLength = 0.0;
 
   // Locate the track in geometry.
   {
@@ -213,9 +309,15 @@ void G4HepEmTrackingManager::TrackElectron(G4Track *aTrack) {
     aTrack->SetTouchableHandle(touchableHandle);
 
     auto* lvol = aTrack->GetTouchable()->GetVolume()->GetLogicalVolume();
-    preStepPoint.SetMaterial(lvol->GetMaterial());
     auto* MCC = lvol->GetMaterialCutsCouple();
-    preStepPoint.SetMaterialCutsCouple(lvol->GetMaterialCutsCouple());
+    auto* sensitive = lvol->GetSensitiveDetector();
+    auto* regionalAction = lvol->GetRegion()->GetRegionalSteppingAction();
+    const bool leanStep = leanStepping && sensitive == nullptr &&
+                          regionalAction == nullptr;
+    if (!leanStep) {
+      preStepPoint.SetMaterial(lvol->GetMaterial());
+      preStepPoint.SetMaterialCutsCouple(MCC);
+    }
 
     // Query step lengths from pyhsics and geometry, decide on limit.
     const G4double preStepEkin = theG4DPart->GetKineticEnergy();
@@ -229,26 +331,46 @@ void G4HepEmTrackingManager::TrackElectron(G4Track *aTrack) {
     bool preStepOnBoundary =
         preStepPoint.GetStepStatus() == G4StepStatus::fGeomBoundary;
     thePrimaryTrack->SetOnBoundary(preStepOnBoundary);
-    const G4double preSafety =
-        preStepOnBoundary ? 0.
-                   : fSafetyHelper->ComputeSafety(aTrack->GetPosition());
-    thePrimaryTrack->SetSafety(preSafety);
 
     // Sample the `number-of-interaction-left`
-    for (int ip=0; ip<3; ++ip) {
-      if (thePrimaryTrack->GetNumIALeft(ip)<=0.) {
-        thePrimaryTrack->SetNumIALeft(-G4HepEmLog(rnge->flat()), ip);
-      }
-    }
+    SampleNumIALeft(thePrimaryTrack, rnge);
     // True distance to discrete interaction.
     G4HepEmElectronManager::HowFarToDiscreteInteraction(theHepEmData, theHepEmPars, theElTrack);
     // Remember which process was selected - MSC might limit the sub-steps.
     const int iDProc = thePrimaryTrack->GetWinnerProcessIndex();
 
+    // The pre-step safety: the last computed one (cached on the track) reduced
+    // by the distance travelled since then is used if this conservative estimate
+    // is large enough for MSC not to limit the step. The navigator is queried
+    // (and the new safety is cached) only otherwise.
+    const G4ThreeVector& preStepPos = aTrack->GetPosition();
+    G4double preSafety = 0.;
+    if (!preStepOnBoundary) {
+      const int hepEmIMat = theHepEmData->fTheMatCutData->fMatCutData[hepEmIMC].fHepEmMatIndex;
+      const G4double mscSafetyLimit = theElTrack->GetRange() *
+          theHepEmData->fTheMaterialData->fMaterialData[hepEmIMat].fUMSCPar;
+      preSafety = thePrimaryTrack->GetSafety(preStepPos.x(), preStepPos.y(), preStepPos.z());
+      if (preSafety <= mscSafetyLimit) {
+        preSafety = fSafetyHelper->ComputeSafety(preStepPos);
+      }
+    }
+    thePrimaryTrack->SetSafety(preSafety, preStepPos.x(), preStepPos.y(), preStepPos.z());
+
     G4double stepLimitLeft = theElTrack->GetPStepLength();
     G4double totalTruePathLength = 0, totalEloss = 0;
     bool continueStepping = fMultipleSteps, stopped = false;
 
+    // The safety sphere around the pre-step point inside which the MSC limited
+    // sub-steps are done without navigation (straight lines: no field).
+    bool useSafetySphere = fMultipleSteps && fMultipleStepsInSafety && preSafety > 0.;
+    if (useSafetySphere) {
+      const G4FieldManager* fieldMgr = lvol->GetFieldManager();
+      if (fieldMgr == nullptr) {
+        fieldMgr = G4TransportationManager::GetTransportationManager()->GetFieldManager();
+      }
+      useSafetySphere = fieldMgr == nullptr || fieldMgr->GetDetectorField() == nullptr;
+    }
+
     theElTrack->SavePreStepEKin();
 
     do {
@@ -262,14 +384,41 @@ void G4HepEmTrackingManager::TrackElectron(G4Track *aTrack) {
       // Get the geometrcal step length: straight line distance to make along the
       // original direction.
       G4double physicalStep = thePrimaryTrack->GetGStepLength();
-      G4double geometryStep = navigation.MakeStep(*aTrack, step, physicalStep);
+      // Request the table rows of the post-step physics while navigating.
+      if (fPrefetchTables) {
+        G4HepEmElectronManager::PrefetchTables(theHepEmData, theHepEmPars, thePrimaryTrack);
+      }
+      // The sub-step stays inside the safety sphere and will be followed by
+      // another one: move the particle without calling the navigator.
+      const G4ThreeVector& subStepPos = aTrack->GetPosition();
+      const G4double subStepSafety = useSafetySphere
+          ? thePrimaryTrack->GetSafety(subStepPos.x(), subStepPos.y(), subStepPos.z())
+          : 0.;
+      const bool isInSafety = useSafetySphere && continueStepping &&
+                              physicalStep < subStepSafety;
+      G4double geometryStep = physicalStep;
+      if (isInSafety) {
+        postStepPoint.SetPosition(aTrack->GetPosition() +
+                                  physicalStep * aTrack->GetMomentumDirection());
+        const G4double velocity = aTrack->GetVelocity();
+        const G4double deltaTime = velocity > 0 ? physicalStep / velocity : 0.0;
+        postStepPoint.AddGlobalTime(deltaTime);
+        postStepPoint.AddLocalTime(deltaTime);
+        postStepPoint.AddProperTime(deltaTime * theG4DPart->GetMass() / aTrack->GetTotalEnergy());
+        postStepPoint.SetSafety(subStepSafety - physicalStep);
+        postStepPoint.SetStepStatus(fAlongStepDoItProc);
+      } else {
+        geometryStep = navigation.MakeStep(*aTrack, step, physicalStep);
+      }
 
       bool geometryLimitedStep = geometryStep < physicalStep;
       G4double finalStep = geometryLimitedStep ? geometryStep : physicalStep;
 
       step.UpdateTrack();
 
-      navigation.FinishStep(*aTrack, step);
+      if (!isInSafety) {
+        navigation.FinishStep(*aTrack, step);
+      }
 
       if (geometryLimitedStep) {
         continueStepping = false;
@@ -346,8 +495,15 @@ void G4HepEmTrackingManager::TrackElectron(G4Track *aTrack) {
               // apply displacement
               bool isPositionChanged = true;
               const G4double dispR = std::sqrt(dLength2);
-              const G4double postSafety =
-                  0.99 * fSafetyHelper->ComputeSafety(position, dispR);
+              // the cached safety is used if it's enough for the displacement
+              // (or inside the safety sphere) otherwise the navigator is queried
+              G4double postSafety =
+                  0.99 * thePrimaryTrack->GetSafety(position.x(), position.y(), position.z());
+              if (!isInSafety && postSafety < dispR) {
+                const G4double safety = fSafetyHelper->ComputeSafety(position, dispR);
+                thePrimaryTrack->SetSafety(safety, position.x(), position.y(), position.z());
+                postSafety = 0.99 * safety;
+              }
               const G4ThreeVector theDisplacement(displacement[0], displacement[1],
                                                   displacement[2]);
               // far away from geometry boundary
@@ -367,7 +523,10 @@ void G4HepEmTrackingManager::TrackElectron(G4Track *aTrack) {
                 }
               }
               if (isPositionChanged) {
-                fSafetyHelper->ReLocateWithinVolume(position);
+                // the navigator is relocated at the next navigation if inside
+                if (!isInSafety) {
+                  fSafetyHelper->ReLocateWithinVolume(position);
+                }
                 postStepPoint.SetPosition(position);
               }
             }
@@ -401,6 +560,7 @@ void G4HepEmTrackingManager::TrackElectron(G4Track *aTrack) {
 
       }
     } while (continueStepping);
+    G4HepEmCOUNT(theTLData->GetCounters().CountStep(thePrimaryTrack);)
 
     // Restore the total (mean) energy loss accumulated along the sub-steps.
     thePrimaryTrack->SetEnergyDeposit(totalEloss);
@@ -416,7 +576,10 @@ void G4HepEmTrackingManager::TrackElectron(G4Track *aTrack) {
     if (stopped) {
       // call annihilation for e+ !!!
       if (!isElectron) {
+        G4HepEmCOUNT(const auto tStart = std::chrono::steady_clock::now();)
         G4HepEmPositronInteractionAnnihilation::Perform(theTLData, true);
+        G4HepEmCOUNT(theTLData->GetCounters().CountInteractionTime(
+            thePrimaryTrack, G4HepEmCounters::kAnnihilation, ElapsedTime(tStart));)
         proc = fElectronNoProcessVector[2];
       } else {
         // otherwise ionization limited the step
@@ -424,7 +587,13 @@ void G4HepEmTrackingManager::TrackElectron(G4Track *aTrack) {
       }
     } else if (aTrack->GetTrackStatus() != fStopAndKill) {
       // === 4. Discrete part of the interaction (if any)
+      G4HepEmCOUNT(const auto tStart = std::chrono::steady_clock::now();)
       G4HepEmElectronManager::PerformDiscrete(theHepEmData, theHepEmPars, theTLData);
+      G4HepEmCOUNT(
+        const int iproc = G4HepEmCounters::GetProcess(thePrimaryTrack);
+        if (iproc >= G4HepEmCounters::kIoni) {
+          theTLData->GetCounters().CountInteractionTime(thePrimaryTrack, iproc, ElapsedTime(tStart));
+        })
       const G4double *pdir = thePrimaryTrack->GetDirection();
       postStepPoint.SetMomentumDirection(
           G4ThreeVector(pdir[0], pdir[1], pdir[2]));
@@ -458,79 +627,25 @@ void G4HepEmTrackingManager::TrackElectron(G4Track *aTrack) {
     }
     step.UpdateTrack();
 
-    const int numSecElectron = theTLData->GetNumSecondaryElectronTrack();
-    const int numSecGamma = theTLData->GetNumSecondaryGammaTrack();
-    const int numSecondaries = numSecElectron + numSecGamma;
-    if (numSecondaries > 0) {
-      const G4ThreeVector &theG4PostStepPointPosition =
-          postStepPoint.GetPosition();
-      const G4double theG4PostStepGlobalTime =
-          postStepPoint.GetGlobalTime();
-      for (int is = 0; is < numSecElectron; ++is) {
-        G4HepEmTrack *secTrack =
-            theTLData->GetSecondaryElectronTrack(is)->GetTrack();
-        const G4double secEKin = secTrack->GetEKin();
-        const bool isElectron = secTrack->GetCharge() < 0.0;
-        if (applyCuts) {
-          if (isElectron && secEKin < (*theCutsElectron)[g4IMC]) {
-            edep += secEKin;
-            continue;
-          } else if (!isElectron &&
-                     CLHEP::electron_mass_c2 < (*theCutsGamma)[g4IMC] &&
-                     secEKin < (*theCutsPositron)[g4IMC]) {
-            edep += secEKin + 2 * CLHEP::electron_mass_c2;
-            continue;
-          }
-        }
-
-        const G4double *dir = secTrack->GetDirection();
-        const G4ParticleDefinition *partDef = G4Electron::Definition();
-        if (!isElectron) {
-          partDef = G4Positron::Definition();
-        }
-        G4DynamicParticle *dp = new G4DynamicParticle(
-            partDef, G4ThreeVector(dir[0], dir[1], dir[2]), secEKin);
-        G4Track *aG4Track = new G4Track(dp, theG4PostStepGlobalTime,
-                                        theG4PostStepPointPosition);
-        aG4Track->SetParentID(trackID);
-        aG4Track->SetCreatorProcess(proc);
-        aG4Track->SetTouchableHandle(touchableHandle);
-        secondaries.push_back(aG4Track);
-      }
-      theTLData->ResetNumSecondaryElectronTrack();
-
-      for (int is = 0; is < numSecGamma; ++is) {
-        G4HepEmTrack *secTrack =
-            theTLData->GetSecondaryGammaTrack(is)->GetTrack();
-        const G4double secEKin = secTrack->GetEKin();
-        if (applyCuts && secEKin < (*theCutsGamma)[g4IMC]) {
-          edep += secEKin;
-          continue;
-        }
+    edep += StackSecondaries(theTLData, aTrack, proc, g4IMC, postStepPoint,
+                             touchableHandle, secondaries);
 
-        const G4double *dir = secTrack->GetDirection();
-        G4DynamicParticle *dp = new G4DynamicParticle(
-            G4Gamma::Definition(), G4ThreeVector(dir[0], dir[1], dir[2]),
-            secEKin);
-        G4Track *aG4Track = new G4Track(dp, theG4PostStepGlobalTime,
-                                        theG4PostStepPointPosition);
-        aG4Track->SetParentID(trackID);
-        aG4Track->SetCreatorProcess(proc);
-        aG4Track->SetTouchableHandle(touchableHandle);
-        secondaries.push_back(aG4Track);
-      }
-      theTLData->ResetNumSecondaryGammaTrack();
+    ScoreStep(step, edep, charge);
+    if (leanStep) {
+      // The track length is updated only at the end of the tracking (or at
+      // the next step that is observed).
+      leanTrackLength += totalTruePathLength;
+      continue;
     }
-
     step.AddTotalEnergyDeposit(edep);
 
     // Need to get the true step length, not the geometry step length!
-    aTrack->AddTrackLength(step.GetStepLength());
+    aTrack->AddTrackLength(leanTrackLength + step.GetStepLength());
+    leanTrackLength = 0.0;
 
     // End of this step: Call sensitive detector and stepping actions.
     if(step.GetControlFlag() != AvoidHitInvocation)
     {
-      auto* sensitive = lvol->GetSensitiveDetector();
       if(sensitive)
       {
         sensitive->Hit(&step);
@@ -542,7 +657,6 @@ void G4HepEmTrackingManager::TrackElectron(G4Track *aTrack) {
       userSteppingAction->UserSteppingAction(&step);
     }
 
-    auto* regionalAction = lvol->GetRegion()->GetRegionalSteppingAction();
     if(regionalAction)
     {
       regionalAction->UserSteppingAction(&step);
@@ -551,12 +665,14 @@ void G4HepEmTrackingManager::TrackElectron(G4Track *aTrack) {
 
   // End of tracking: Inform processes and user.
   // === EndTracking ===
+  aTrack->AddTrackLength(leanTrackLength);
 
   if(userTrackingAction)
   {
     userTrackingAction->PostUserTrackingAction(aTrack);
   }
 
+  PushToLocalStack(secondaries);
   evtMgr->StackTracks(&secondaries);
 }
 
@@ -575,6 +691,24 @@ void G4HepEmTrackingManager::TrackGamma(G4Track *aTrack) {
     }
 
     G4double GetPhysicalInteractionLength(const G4Track &track) override {
+      // Use Woodcock tracking if the gamma is inside a Woodcock tracking region
+      fIsWDTStep = false;
+      if (fMgr.fWoodcockHelper != nullptr) {
+        const G4LogicalVolume *lvol =
+            track.GetTouchable()->GetVolume()->GetLogicalVolume();
+        const G4int iregion = fMgr.fWoodcockHelper->GetRegionIndex(lvol);
+        if (iregion >= 0) {
+          const G4DynamicParticle *theG4DPart = track.GetDynamicParticle();
+          const G4double majorant = fMgr.fWoodcockHelper->GetMajorantMacXSec(
+              iregion, theG4DPart->GetKineticEnergy(),
+              theG4DPart->GetLogKineticEnergy());
+          if (majorant > 0.0) {
+            fIsWDTStep = true;
+            return WoodcockFlight(track, iregion, majorant);
+          }
+        }
+      }
+
       G4HepEmTLData *theTLData = fMgr.fRunManager->GetTheTLData();
       G4HepEmTrack *thePrimaryTrack =
           theTLData->GetPrimaryGammaTrack()->GetTrack();
@@ -598,6 +732,83 @@ void G4HepEmTrackingManager::TrackGamma(G4Track *aTrack) {
       return thePrimaryTrack->GetGStepLength();
     }
 
+    // Samples the distance to the next real interaction inside the root volume
+    // of the Woodcock tracking region: the flight is done with the majorant
+    // macroscopic cross section, the geometry is only queried at the sampled
+    // interaction points to decide if the interaction is real or fictitious.
+    // Returns the distance to the real interaction point or to the boundary of
+    // the root volume of the region (`fWDTInteraction` is false in this case).
+    // The state of the primary G4HepEm gamma track is set to the post step
+    // point in case of real interaction (with the winner process selected).
+    G4double WoodcockFlight(const G4Track &track, G4int iregion,
+                            G4double majorant) {
+      G4HepEmTLData *theTLData = fMgr.fRunManager->GetTheTLData();
+      G4HepEmGammaTrack *theGammaTrack = theTLData->GetPrimaryGammaTrack();
+      G4HepEmTrack *thePrimaryTrack = theGammaTrack->GetTrack();
+      G4HepEmData *theHepEmData = fMgr.fRunManager->GetHepEmData();
+      G4HepEmRandomEngine *rnge = theTLData->GetRNGEngine();
+      const G4DynamicParticle *theG4DPart = track.GetDynamicParticle();
+      thePrimaryTrack->SetCharge(0);
+      thePrimaryTrack->SetEKin(theG4DPart->GetKineticEnergy(),
+                               theG4DPart->GetLogKineticEnergy());
+
+      auto *navigator = G4TransportationManager::GetTransportationManager()
+                            ->GetNavigatorForTracking();
+      const G4ThreeVector &pos = track.GetPosition();
+      const G4ThreeVector &dir = track.GetMomentumDirection();
+      const G4double distToExit = fMgr.fWoodcockHelper->ComputeDistanceToRootExit(
+          iregion, track.GetTouchable(), pos, dir);
+      const G4double invMajorant = 1.0 / majorant;
+      fWDTInteraction = false;
+      G4double flightLength = 0.0;
+      while (true) {
+        flightLength -= G4HepEmLog(rnge->flat()) * invMajorant;
+        if (flightLength >= distToExit) {
+          return distToExit;
+        }
+        // locate the sampled interaction point and check if it's real
+        const G4ThreeVector point = pos + flightLength * dir;
+        const G4VPhysicalVolume *pvol =
+            navigator->LocateGlobalPointAndSetup(point, &dir, true, false);
+        const int g4IMC =
+            pvol->GetLogicalVolume()->GetMaterialCutsCouple()->GetIndex();
+        thePrimaryTrack->SetMCIndex(
+            theHepEmData->fTheMatCutData->fG4MCIndexToHepEmMCIndex[g4IMC]);
+        const G4double totalMacXSec =
+            G4HepEmGammaManager::GetTotalMacXSec(theHepEmData, theGammaTrack);
+        const G4double urnd = rnge->flat() * majorant;
+        if (totalMacXSec > majorant) {
+          // the majorant is violated: the acceptance probability is clamped
+          // to 1, i.e. the interaction is real (`urnd` is uniform on
+          // [0, majorant) now)
+          fMgr.fWoodcockHelper->CountMajorantViolation(
+              theG4DPart->GetKineticEnergy(), totalMacXSec, majorant);
+          G4HepEmGammaManager::SelectInteraction(thePrimaryTrack, totalMacXSec,
+                                                 urnd * invMajorant);
+          fWDTInteraction = true;
+          return flightLength;
+        }
+        if (urnd < totalMacXSec) {
+          // real interaction: select the one that happens (the random number
+          // is still uniform on [0, totalMacXSec))
+          G4HepEmGammaManager::SelectInteraction(thePrimaryTrack, totalMacXSec,
+                                                 urnd / totalMacXSec);
+          fWDTInteraction = true;
+          return flightLength;
+        }
+      }
+    }
+
+    G4bool IsWDTStep() const { return fIsWDTStep; }
+    G4bool IsWDTInteraction() const { return fWDTInteraction; }
+
+    void PostTracking(G4TrackVector &secondaries) override {
+      // Keep the secondaries locally (if enabled) before the helper gives the
+      // rest back to Geant4: after the user tracking action, that might look
+      // at the secondaries, as in the e-/e+ tracking.
+      fMgr.PushToLocalStack(secondaries);
+    }
+
     void AlongStepDoIt(G4Track &track, G4Step &step, G4TrackVector &) override {
       // Nothing to do here!
     }
@@ -611,10 +822,18 @@ void G4HepEmTrackingManager::TrackGamma(G4Track *aTrack) {
       G4HepEmTrack *thePrimaryTrack =
           theTLData->GetPrimaryGammaTrack()->GetTrack();
 
+      if (fIsWDTStep && !fWDTInteraction) {
+        // Woodcock tracking step till the boundary of the region: the
+        // `number-of-interaction-left` were not used so they are kept
+        theG4PostStepPoint->SetProcessDefinedStep(fMgr.fTransportNoProcess);
+        fMgr.ScoreStep(step, 0.0, 0.0);
+        return;
+      }
       if (onBoundary) {
         thePrimaryTrack->SetGStepLength(track.GetStepLength());
         G4HepEmGammaManager::UpdateNumIALeft(thePrimaryTrack);
         theG4PostStepPoint->SetProcessDefinedStep(fMgr.fTransportNoProcess);
+        fMgr.ScoreStep(step, 0.0, 0.0);
         return;
       }
       // NOTE: this primary track is the same as in the last call in the
@@ -624,13 +843,20 @@ void G4HepEmTrackingManager::TrackGamma(G4Track *aTrack) {
       const G4ThreeVector &primDir =
           track.GetDynamicParticle()->GetMomentumDirection();
       thePrimaryTrack->SetDirection(primDir[0], primDir[1], primDir[2]);
-      thePrimaryTrack->SetGStepLength(track.GetStepLength());
+      // Woodcock tracking: the mat-cut, mfp-s and the winner process are already
+      // set at the interaction point while the `number-of-interaction-left`
+      // must not be updated by the step length
+      thePrimaryTrack->SetGStepLength(fIsWDTStep ? 0.0 : track.GetStepLength());
       thePrimaryTrack->SetOnBoundary(onBoundary);
       // invoke the physics interactions (all i.e. all along- and post-step as
       // well as possible at rest)
+      G4HepEmCOUNT(const auto tStart = std::chrono::steady_clock::now();)
       G4HepEmGammaManager::Perform(fMgr.fRunManager->GetHepEmData(),
                                    fMgr.fRunManager->GetHepEmParameters(),
                                    theTLData);
+      G4HepEmCOUNT(theTLData->GetCounters().CountInteractionTime(
+          thePrimaryTrack, G4HepEmCounters::GetProcess(thePrimaryTrack),
+          ElapsedTime(tStart));)
 
       const int iDProc = thePrimaryTrack->GetWinnerProcessIndex();
       const G4VProcess *proc = fMgr.fGammaNoProcessVector[iDProc];
@@ -652,94 +878,273 @@ void G4HepEmTrackingManager::TrackGamma(G4Track *aTrack) {
       const int g4IMC =
           step.GetPreStepPoint()->GetMaterialCutsCouple()->GetIndex();
       // secondary: only possible is e- or gamma at the moemnt
-      const int numSecElectron = theTLData->GetNumSecondaryElectronTrack();
-      const int numSecGamma = theTLData->GetNumSecondaryGammaTrack();
-      const int numSecondaries = numSecElectron + numSecGamma;
-      if (numSecondaries > 0) {
-        const G4ThreeVector &theG4PostStepPointPosition =
-            theG4PostStepPoint->GetPosition();
-        const G4double theG4PostStepGlobalTime =
-            theG4PostStepPoint->GetGlobalTime();
-        const G4TouchableHandle &theG4TouchableHandle =
-            track.GetTouchableHandle();
-        for (int is = 0; is < numSecElectron; ++is) {
-          G4HepEmTrack *secTrack =
-              theTLData->GetSecondaryElectronTrack(is)->GetTrack();
-          const G4double secEKin = secTrack->GetEKin();
-          const bool isElectron = secTrack->GetCharge() < 0.0;
-          if (fMgr.applyCuts) {
-            if (isElectron && secEKin < (*fMgr.theCutsElectron)[g4IMC]) {
-              edep += secEKin;
-              continue;
-            } else if (!isElectron &&
-                       CLHEP::electron_mass_c2 < (*fMgr.theCutsGamma)[g4IMC] &&
-                       secEKin < (*fMgr.theCutsPositron)[g4IMC]) {
-              edep += secEKin + 2 * CLHEP::electron_mass_c2;
-              continue;
-            }
-          }
+      edep += fMgr.StackSecondaries(theTLData, &track, proc, g4IMC,
+                                    *theG4PostStepPoint,
+                                    fIsWDTStep
+                                        ? theG4PostStepPoint->GetTouchableHandle()
+                                        : track.GetTouchableHandle(),
+                                    secondaries);
 
-          const G4double *dir = secTrack->GetDirection();
-          const G4ParticleDefinition *partDef = G4Electron::Definition();
-          if (!isElectron) {
-            partDef = G4Positron::Definition();
-          }
-          G4DynamicParticle *dp = new G4DynamicParticle(
-              partDef, G4ThreeVector(dir[0], dir[1], dir[2]), secEKin);
-          G4Track *aG4Track = new G4Track(dp, theG4PostStepGlobalTime,
-                                          theG4PostStepPointPosition);
-          aG4Track->SetParentID(track.GetTrackID());
-          aG4Track->SetCreatorProcess(proc);
-          aG4Track->SetTouchableHandle(theG4TouchableHandle);
-          secondaries.push_back(aG4Track);
-        }
-        theTLData->ResetNumSecondaryElectronTrack();
-
-        for (int is = 0; is < numSecGamma; ++is) {
-          G4HepEmTrack *secTrack =
-              theTLData->GetSecondaryGammaTrack(is)->GetTrack();
-          const G4double secEKin = secTrack->GetEKin();
-          if (fMgr.applyCuts && secEKin < (*fMgr.theCutsGamma)[g4IMC]) {
-            edep += secEKin;
-            continue;
-          }
+      step.AddTotalEnergyDeposit(edep);
+      fMgr.ScoreStep(step, edep, 0.0);
+    }
 
-          const G4double *dir = secTrack->GetDirection();
-          G4DynamicParticle *dp = new G4DynamicParticle(
-              G4Gamma::Definition(), G4ThreeVector(dir[0], dir[1], dir[2]),
-              secEKin);
-          G4Track *aG4Track = new G4Track(dp, theG4PostStepGlobalTime,
-                                          theG4PostStepPointPosition);
-          aG4Track->SetParentID(track.GetTrackID());
-          aG4Track->SetCreatorProcess(proc);
-          aG4Track->SetTouchableHandle(theG4TouchableHandle);
-          secondaries.push_back(aG4Track);
-        }
-        theTLData->ResetNumSecondaryGammaTrack();
+  private:
+    G4HepEmTrackingManager &fMgr;
+    G4bool fIsWDTStep = false;
+    G4bool fWDTInteraction = false;
+  };
+
+  // Navigation that moves the gamma straight to the end of the Woodcock
+  // tracking flight (if any) and relocates it there. The normal neutral
+  // navigation is used otherwise.
+  class WoodcockNavigation final : public TrackingManagerHelper::Navigation {
+  public:
+    WoodcockNavigation(const GammaPhysics &physics) : fPhysics(physics) {
+      fLinearNavigator = G4TransportationManager::GetTransportationManager()
+                             ->GetNavigatorForTracking();
+    }
+
+    G4double MakeStep(G4Track &track, G4Step &step,
+                      G4double physicalStep) override {
+      if (!fPhysics.IsWDTStep()) {
+        return fNeutralNavigation.MakeStep(track, step, physicalStep);
       }
+      G4StepPoint &postStepPoint = *step.GetPostStepPoint();
+      postStepPoint.SetPosition(track.GetPosition() +
+                                physicalStep * track.GetMomentumDirection());
+      const G4double velocity = track.GetVelocity();
+      const G4double deltaTime = velocity > 0 ? physicalStep / velocity : 0.0;
+      postStepPoint.AddGlobalTime(deltaTime);
+      postStepPoint.AddLocalTime(deltaTime);
+      return physicalStep;
+    }
 
-      step.AddTotalEnergyDeposit(edep);
+    void FinishStep(G4Track &track, G4Step &step) override {
+      if (!fPhysics.IsWDTStep()) {
+        fNeutralNavigation.FinishStep(track, step);
+        return;
+      }
+      // The volume at the end of the flight is unknown: full relocation.
+      G4StepPoint &postStepPoint = *step.GetPostStepPoint();
+      postStepPoint.SetSafety(0.0);
+      G4TouchableHandle touchableHandle = track.GetTouchableHandle();
+      const bool isInteraction = fPhysics.IsWDTInteraction();
+      if (!isInteraction) {
+        fLinearNavigator->SetGeometricallyLimitedStep();
+      }
+      fLinearNavigator->LocateGlobalPointAndUpdateTouchableHandle(
+          track.GetPosition(), track.GetMomentumDirection(), touchableHandle,
+          false);
+      const G4VPhysicalVolume *newVolume = touchableHandle->GetVolume();
+      if (newVolume == nullptr) {
+        postStepPoint.SetStepStatus(fWorldBoundary);
+      } else {
+        postStepPoint.SetStepStatus(isInteraction ? fPostStepDoItProc
+                                                  : fGeomBoundary);
+      }
+      postStepPoint.SetTouchableHandle(touchableHandle);
+      track.SetNextTouchableHandle(touchableHandle);
+      if (isInteraction) {
+        // Set the pre-step point to the volume of the real interaction: this
+        // is where the energy is deposited and the secondaries are produced.
+        auto *lvol = newVolume->GetLogicalVolume();
+        G4StepPoint &preStepPoint = *step.GetPreStepPoint();
+        preStepPoint.SetTouchableHandle(touchableHandle);
+        preStepPoint.SetMaterial(lvol->GetMaterial());
+        preStepPoint.SetMaterialCutsCouple(lvol->GetMaterialCutsCouple());
+      }
     }
 
   private:
-    G4HepEmTrackingManager &fMgr;
+    const GammaPhysics &fPhysics;
+    TrackingManagerHelper::NeutralNavigation fNeutralNavigation;
+    G4Navigator *fLinearNavigator;
   };
 
   GammaPhysics physics(*this);
-  TrackingManagerHelper::TrackNeutralParticle(aTrack, fStep, physics);
+  if (fWoodcockHelper == nullptr) {
+    TrackingManagerHelper::TrackNeutralParticle(aTrack, fStep, physics);
+  } else {
+    WoodcockNavigation navigation(physics);
+    TrackingManagerHelper::TrackParticle(aTrack, fStep, physics, navigation);
+  }
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
-void G4HepEmTrackingManager::HandOverOneTrack(G4Track *aTrack) {
+G4double G4HepEmTrackingManager::StackSecondaries(
+    G4HepEmTLData *theTLData, const G4Track *aTrack, const G4VProcess *proc,
+    int g4IMC, const G4StepPoint &postStepPoint,
+    const G4TouchableHandle &touchableHandle, G4TrackVector &secondaries) {
+  const int numSecElectron = theTLData->GetNumSecondaryElectronTrack();
+  const int numSecGamma = theTLData->GetNumSecondaryGammaTrack();
+  const int numSecondaries = numSecElectron + numSecGamma;
+  if (numSecondaries == 0) {
+    return 0.0;
+  }
+  // Energy deposited by the secondaries that are killed by the cuts (if any).
+  G4double edep = 0.0;
+  // All secondaries are created at the same post-step point: fetch the common
+  // state only once and grow the secondary vector at most once for the whole
+  // batch. Note, that the `G4Track` and `G4DynamicParticle` objects are taken
+  // from the thread local `G4Allocator` pools of Geant4 by their `new`.
+  secondaries.reserve(secondaries.size() + numSecondaries);
+  const G4ThreeVector &theG4PostStepPointPosition = postStepPoint.GetPosition();
+  const G4double theG4PostStepGlobalTime = postStepPoint.GetGlobalTime();
+  const G4int parentID = aTrack->GetTrackID();
+  const G4ParticleDefinition *electronDef = G4Electron::Definition();
+  const G4ParticleDefinition *positronDef = G4Positron::Definition();
+  const G4ParticleDefinition *gammaDef = G4Gamma::Definition();
+  // The cut values are the same for all secondaries in this step.
+  const G4double cutElectron = applyCuts ? (*theCutsElectron)[g4IMC] : 0.0;
+  const G4double cutPositron = applyCuts ? (*theCutsPositron)[g4IMC] : 0.0;
+  const G4double cutGamma = applyCuts ? (*theCutsGamma)[g4IMC] : 0.0;
+
+  for (int is = 0; is < numSecElectron; ++is) {
+    G4HepEmTrack *secTrack =
+        theTLData->GetSecondaryElectronTrack(is)->GetTrack();
+    const G4double secEKin = secTrack->GetEKin();
+    const bool isElectron = secTrack->GetCharge() < 0.0;
+    if (applyCuts) {
+      if (isElectron && secEKin < cutElectron) {
+        edep += secEKin;
+        continue;
+      } else if (!isElectron && CLHEP::electron_mass_c2 < cutGamma &&
+                 secEKin < cutPositron) {
+        edep += secEKin + 2 * CLHEP::electron_mass_c2;
+        continue;
+      }
+    }
+
+    const G4double *dir = secTrack->GetDirection();
+    G4DynamicParticle *dp = new G4DynamicParticle(
+        isElectron ? electronDef : positronDef,
+        G4ThreeVector(dir[0], dir[1], dir[2]), secEKin);
+    G4Track *aG4Track =
+        new G4Track(dp, theG4PostStepGlobalTime, theG4PostStepPointPosition);
+    aG4Track->SetParentID(parentID);
+    aG4Track->SetCreatorProcess(proc);
+    aG4Track->SetTouchableHandle(touchableHandle);
+    secondaries.push_back(aG4Track);
+  }
+  theTLData->ResetNumSecondaryElectronTrack();
+
+  for (int is = 0; is < numSecGamma; ++is) {
+    G4HepEmTrack *secTrack = theTLData->GetSecondaryGammaTrack(is)->GetTrack();
+    const G4double secEKin = secTrack->GetEKin();
+    if (applyCuts && secEKin < cutGamma) {
+      edep += secEKin;
+      continue;
+    }
+
+    const G4double *dir = secTrack->GetDirection();
+    G4DynamicParticle *dp = new G4DynamicParticle(
+        gammaDef, G4ThreeVector(dir[0], dir[1], dir[2]), secEKin);
+    G4Track *aG4Track =
+        new G4Track(dp, theG4PostStepGlobalTime, theG4PostStepPointPosition);
+    aG4Track->SetParentID(parentID);
+    aG4Track->SetCreatorProcess(proc);
+    aG4Track->SetTouchableHandle(touchableHandle);
+    secondaries.push_back(aG4Track);
+  }
+  theTLData->ResetNumSecondaryGammaTrack();
+
+  return edep;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void G4HepEmTrackingManager::SetScoring(G4HepEmScoring *scoring) {
+  G4HepEmScoring::Buffer *buffer = scoring->CreateThreadBuffer();
+  fScoringCallback = [scoring, buffer](const G4LogicalVolume *logicalVolume,
+                                       G4int copyNumber, G4double edep,
+                                       G4double stepLength, G4double charge) {
+    buffer->Accumulate(scoring->GetVolumeID(logicalVolume, copyNumber), edep,
+                       stepLength, charge);
+  };
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void G4HepEmTrackingManager::ScoreStep(const G4Step &step, G4double edep,
+                                       G4double charge) const {
+  if (fScoringCallback) {
+    const G4TouchableHandle &touchable =
+        step.GetPreStepPoint()->GetTouchableHandle();
+    fScoringCallback(touchable->GetVolume()->GetLogicalVolume(),
+                     touchable->GetCopyNumber(), edep, step.GetStepLength(),
+                     charge);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void G4HepEmTrackingManager::PushToLocalStack(G4TrackVector &secondaries) {
+  if (!fLocalSecondaryStack || secondaries.empty()) {
+    return;
+  }
+  auto *evtMgr = G4EventManager::GetEventManager();
+  // All tracks must be seen by Geant4 in these cases.
+  if (evtMgr->GetUserStackingAction() != nullptr ||
+      evtMgr->GetTrackingManager()->GetStoreTrajectory() != 0) {
+    return;
+  }
+  // Restart the local track ID counter in each new event.
+  const G4int eventID = evtMgr->GetConstCurrentEvent()->GetEventID();
+  if (eventID != fLocalStackEventID) {
+    fLocalStackEventID = eventID;
+    fLocalStackTrackID = kLocalStackFirstTrackID;
+  }
+  const G4ParticleDefinition *electronDef = G4Electron::Definition();
+  const G4ParticleDefinition *positronDef = G4Positron::Definition();
+  const G4ParticleDefinition *gammaDef = G4Gamma::Definition();
+  std::size_t numLeft = 0;
+  for (auto *track : secondaries) {
+    const G4ParticleDefinition *partDef = track->GetParticleDefinition();
+    const bool isHepEmParticle = partDef == electronDef ||
+                                 partDef == positronDef || partDef == gammaDef;
+    if (isHepEmParticle && track->GetTrackStatus() == fAlive &&
+        track->GetKineticEnergy() < fLocalStackEnergyLimit) {
+      track->SetTrackID(++fLocalStackTrackID);
+      fLocalTrackStack.push_back(track);
+    } else {
+      secondaries[numLeft++] = track;
+    }
+  }
+  secondaries.resize(numLeft);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void G4HepEmTrackingManager::TrackOneTrack(G4Track *aTrack) {
   const G4ParticleDefinition *part = aTrack->GetParticleDefinition();
 
+  G4HepEmCOUNT(const auto tStart = std::chrono::steady_clock::now();)
   if (part == G4Electron::Definition() || part == G4Positron::Definition()) {
     TrackElectron(aTrack);
+    G4HepEmCOUNT(fRunManager->GetTheTLData()->GetCounters().CountTrackingTime(
+        part == G4Electron::Definition() ? G4HepEmCounters::kElectron
+                                         : G4HepEmCounters::kPositron,
+        ElapsedTime(tStart));)
   } else if (part == G4Gamma::Definition()) {
     TrackGamma(aTrack);
+    G4HepEmCOUNT(fRunManager->GetTheTLData()->GetCounters().CountTrackingTime(
+        G4HepEmCounters::kGamma, ElapsedTime(tStart));)
   }
 
   aTrack->SetTrackStatus(fStopAndKill);
   delete aTrack;
 }
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void G4HepEmTrackingManager::HandOverOneTrack(G4Track *aTrack) {
+  TrackOneTrack(aTrack);
+  // Track all secondaries that were kept locally (LIFO as the Geant4 stack).
+  while (!fLocalTrackStack.empty()) {
+    G4Track *track = fLocalTrackStack.back();
+    fLocalTrackStack.pop_back();
+    TrackOneTrack(track);
+  }
+}
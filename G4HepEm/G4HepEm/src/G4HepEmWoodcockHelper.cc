@@ -0,0 +1,213 @@
+#include "ad_type.h"
+#include "G4HepEmWoodcockHelper.hh"
+
+#include "G4HepEmData.hh"
+#include "G4HepEmMatCutData.hh"
+#include "G4HepEmMaterialData.hh"
+#include "G4HepEmGammaData.hh"
+#include "G4HepEmGammaManager.hh"
+#include "G4HepEmMath.hh"
+
+#include "G4AffineTransform.hh"
+#include "G4LogicalVolume.hh"
+#include "G4MaterialCutsCouple.hh"
+#include "G4NavigationHistory.hh"
+#include "G4Region.hh"
+#include "G4RegionStore.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4VSolid.hh"
+#include "G4VTouchable.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4HepEmWoodcockHelper::G4HepEmWoodcockHelper()
+    : fNumEnergyBins(0), fMinEnergy(0.), fMaxEnergy(0.), fLogMinEnergy(0.),
+      fInvLogDelta(0.), fNumMajorantViolations(0) {}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4HepEmWoodcockHelper::~G4HepEmWoodcockHelper() {
+  if (fNumMajorantViolations > 0) {
+    std::cerr << " *** WARNING in G4HepEmWoodcockHelper: the majorant "
+              << "macroscopic cross section was violated at "
+              << fNumMajorantViolations << " interaction points." << std::endl;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void G4HepEmWoodcockHelper::Initialize(
+    const std::vector<G4String> &regionNames, struct G4HepEmData *hepEmData) {
+  fRegions.clear();
+  const G4HepEmGammaData *theGammaData = hepEmData->fTheGammaData;
+  fNumEnergyBins = theGammaData->fCompEnergyGridSize - 1;
+  fMinEnergy = theGammaData->fCompEnergyGrid[0];
+  fMaxEnergy = theGammaData->fCompEnergyGrid[fNumEnergyBins];
+  fLogMinEnergy = theGammaData->fCompLogMinEkin;
+  fInvLogDelta = theGammaData->fCompEILDelta;
+
+  for (const auto &name : regionNames) {
+    const G4Region *region =
+        G4RegionStore::GetInstance()->GetRegion(name, false);
+    if (region == nullptr) {
+      std::cerr << " *** WARNING in G4HepEmWoodcockHelper::Initialize: "
+                << "region " << name
+                << " cannot be found: no Woodcock tracking in this region. "
+                << std::endl;
+      continue;
+    }
+    // Collect all couples that can be found inside the root logical volume(s)
+    // of this region (including daughters that might belong to other regions).
+    std::vector<const G4LogicalVolume *> visited;
+    std::vector<G4int> g4MCIndices;
+    auto itrLV = const_cast<G4Region *>(region)->GetRootLogicalVolumeIterator();
+    for (std::size_t ilv = 0; ilv < region->GetNumberOfRootVolumes();
+         ++ilv, ++itrLV) {
+      CollectCoupleIndices(*itrLV, visited, g4MCIndices);
+    }
+    WDTRegionData data;
+    data.fRegion = region;
+    data.fMajorantMacXSec.resize(fNumEnergyBins);
+    for (G4int ibin = 0; ibin < fNumEnergyBins; ++ibin) {
+      data.fMajorantMacXSec[ibin] =
+          ComputeMajorant(g4MCIndices, ibin, hepEmData);
+    }
+    fRegions.push_back(data);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4double G4HepEmWoodcockHelper::GetMajorantMacXSec(G4int iregion, G4double ekin,
+                                                   G4double lekin) const {
+  if (ekin < fMinEnergy || ekin >= fMaxEnergy) {
+    return -1.0;
+  }
+  const G4int ibin = std::min(
+      (G4int)GET_VALUE((lekin - fLogMinEnergy) * fInvLogDelta), fNumEnergyBins - 1);
+  return fRegions[iregion].fMajorantMacXSec[std::max(0, ibin)];
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void G4HepEmWoodcockHelper::CountMajorantViolation(G4double ekin,
+                                                   G4double totalMacXSec,
+                                                   G4double majorant) {
+  if (fNumMajorantViolations++ == 0) {
+    std::cerr << " *** WARNING in G4HepEmWoodcockHelper: the total macroscopic "
+              << "cross section " << totalMacXSec << " [1/mm] is larger than "
+              << "the majorant " << majorant << " [1/mm] at E = " << ekin
+              << " [MeV] (interaction accepted as real; further violations "
+              << "are only counted)." << std::endl;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4double G4HepEmWoodcockHelper::ComputeDistanceToRootExit(
+    G4int iregion, const G4VTouchable *touchable, const G4ThreeVector &pos,
+    const G4ThreeVector &dir) const {
+  const G4Region *region = fRegions[iregion].fRegion;
+  const G4int historyDepth = touchable->GetHistoryDepth();
+  for (G4int depth = 0; depth <= historyDepth; ++depth) {
+    const G4LogicalVolume *lvol = touchable->GetVolume(depth)->GetLogicalVolume();
+    if (lvol->IsRootRegion() && lvol->GetRegion() == region) {
+      const G4AffineTransform &transform =
+          touchable->GetHistory()->GetTransform(historyDepth - depth);
+      const G4ThreeVector localPos = transform.TransformPoint(pos);
+      const G4ThreeVector localDir = transform.TransformAxis(dir);
+      return lvol->GetSolid()->DistanceToOut(localPos, localDir);
+    }
+  }
+  // should not happen: the root of the region is always in the history
+  return 0.0;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4double G4HepEmWoodcockHelper::ComputeMajorant(
+    const std::vector<G4int> &g4MCIndices, G4int ibin,
+    struct G4HepEmData *hepEmData) const {
+  // Safety factor to account the (small) deviations of the spline interpolated
+  // conversion and Compton cross sections between the sampling points.
+  const G4double kSafety = 1.05;
+  const G4int kNumSubBins = 8;
+  const G4HepEmGammaData *theGammaData = hepEmData->fTheGammaData;
+  const G4double emin = theGammaData->fCompEnergyGrid[ibin];
+  const G4double emax = theGammaData->fCompEnergyGrid[ibin + 1];
+  const G4double lemin = G4HepEmLog(emin);
+  const G4double dlsub = (G4HepEmLog(emax) - lemin) / kNumSubBins;
+  // the total macroscopic cross section of material `imat` at `ekin` by the
+  // same lookup as at run time (fused, single or double precision tables)
+  auto totalMacXSec = [&](G4int imat, G4double ekin) -> G4double {
+    G4double mxSecs[3];
+    return G4HepEmGammaManager::GetMacXSecs(hepEmData, imat, ekin,
+                                            G4HepEmLog(ekin), mxSecs);
+  };
+  // the fused table is linear (in log-energy) between its grid points so its
+  // maxima are at the grid points inside the bin
+  std::vector<G4double> fusedKnots;
+  if (theGammaData->fFusedMacXsecData != nullptr) {
+    for (G4int i = 0; i < theGammaData->fFusedEnergyGridSize; ++i) {
+      const G4double knot = theGammaData->fFusedEnergyGrid[i];
+      if (knot > emin && knot < emax) {
+        fusedKnots.push_back(knot);
+      }
+    }
+  }
+  G4double majorant = 0.0;
+  for (G4int g4IMC : g4MCIndices) {
+    const G4int hepEmIMC =
+        hepEmData->fTheMatCutData->fG4MCIndexToHepEmMCIndex[g4IMC];
+    if (hepEmIMC < 0) {
+      continue;
+    }
+    const G4int imat =
+        hepEmData->fTheMatCutData->fMatCutData[hepEmIMC].fHepEmMatIndex;
+    for (G4int is = 0; is <= kNumSubBins; ++is) {
+      const G4double ekin = is < kNumSubBins ? G4HepEmExp(lemin + is * dlsub) : emax;
+      majorant = G4HepEmMax(majorant, totalMacXSec(imat, ekin));
+    }
+    // the photoelectric cross section has its local maxima at the absorption
+    // edges (i.e. at the lower edges of the Sandia intervals)
+    const G4HepEmMatData &matData =
+        hepEmData->fTheMaterialData->fMaterialData[imat];
+    for (G4int i = 0; i < matData.fNumOfSandiaIntervals; ++i) {
+      const G4double edge = matData.fSandiaEnergies[i];
+      if (edge > emin && edge < emax) {
+        majorant = G4HepEmMax(majorant, totalMacXSec(imat, edge));
+      }
+    }
+    for (G4double knot : fusedKnots) {
+      majorant = G4HepEmMax(majorant, totalMacXSec(imat, knot));
+    }
+  }
+  return kSafety * majorant;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void G4HepEmWoodcockHelper::CollectCoupleIndices(
+    const G4LogicalVolume *lvol, std::vector<const G4LogicalVolume *> &visited,
+    std::vector<G4int> &g4MCIndices) const {
+  if (std::find(visited.begin(), visited.end(), lvol) != visited.end()) {
+    return;
+  }
+  visited.push_back(lvol);
+  const G4MaterialCutsCouple *couple = lvol->GetMaterialCutsCouple();
+  if (couple != nullptr) {
+    const G4int g4IMC = couple->GetIndex();
+    if (std::find(g4MCIndices.begin(), g4MCIndices.end(), g4IMC) ==
+        g4MCIndices.end()) {
+      g4MCIndices.push_back(g4IMC);
+    }
+  }
+  for (std::size_t id = 0; id < lvol->GetNoDaughters(); ++id) {
+    CollectCoupleIndices(lvol->GetDaughter(id)->GetLogicalVolume(), visited,
+                         g4MCIndices);
+  }
+}
@@ -58,6 +58,11 @@ class TrackingManagerHelper
     virtual void StartTracking(G4Track*) {}
     virtual void EndTracking() {}
 
+    // This method is called at the end of tracking, after the user tracking
+    // action, with the secondaries that are given back to the G4EventManager
+    // afterwards: they can be taken (removed from the container) here.
+    virtual void PostTracking(G4TrackVector& secondaries) { (void) secondaries; }
+
     // Combines AlongStep and PostStep; the implementation needs to remember
     // the right value to pass as previousStepSize to G4VProcess.
     virtual G4double GetPhysicalInteractionLength(const G4Track& track) = 0;
@@ -81,6 +81,30 @@ void InitG4HepEmData (struct G4HepEmData* theHepEmData);
 void FreeG4HepEmData (struct G4HepEmData* theHepEmData);
 
 
+/**
+ * Creates a host side replica of the (read-only) run-time data, e.g. for a
+ * given NUMA node.
+ *
+ * The large data arrays (e-/e+ energy loss, macroscopic cross section and target
+ * element selector data, the Seltzer-Berger sampling tables and the gamma
+ * macroscopic cross section, element selector and photoelectric data) are copied
+ * into new arrays written by the calling thread, so the first touch places
+ * their pages on the NUMA node of that thread (that should be pinned to one of
+ * its CPUs). All the other (small) members are shared with `theHepEmData`.
+ * With `useHugePages` the copies of the arrays, that are larger than a huge
+ * page, are 2 MB aligned and advised to be backed by transparent huge pages
+ * (on Linux).
+ *
+ * The replica must be freed by `FreeG4HepEmDataReplica()` before (the shared
+ * parts of) `theHepEmData` are freed. Returns `nullptr` in the AD builds (the
+ * data can only be shared then).
+ */
+struct G4HepEmData* MakeG4HepEmDataReplica (const struct G4HepEmData* theHepEmData, bool useHugePages);
+
+/** Frees a replica created by `MakeG4HepEmDataReplica()` (only its own parts) and sets the pointer to null.*/
+void FreeG4HepEmDataReplica (struct G4HepEmData** theReplica);
+
+
 #ifdef G4HepEm_CUDA_BUILD
   /** Function that ...*/
   void CopyG4HepEmDataToGPU(struct G4HepEmData* onCPU);
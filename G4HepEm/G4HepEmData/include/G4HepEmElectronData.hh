@@ -166,7 +166,8 @@ struct G4HepEmElectronData {
 ///@{
   /** Total number of restricted macroscopic cross sections realted data stored in the single G4HepEmElectronData::fResMacXSecData array.*/
   int        fResMacXSecNumData = 0;
-  /** Start index of the macroscopic cross section data, for the material - cuts couple with the given index, in the G4HepEmElectronData::fResMacXSecData array.*/
+  /** Start index of the macroscopic cross section data, for the material - cuts couple with the given index, in the G4HepEmElectronData::fResMacXSecData array.
+    * Material - cuts couples with identical data share the same (single copy of the) data, i.e. have the same start index.*/
   int*       fResMacXSecStartIndexPerMatCut = nullptr;  // [fNumMatCuts]
   /** The restricted macroscopic cross section data for **ionisation** and **bremsstrahlung** for all material - cuts couples.
    *
@@ -266,6 +267,130 @@ struct G4HepEmElectronData {
   G4double*    fTr1MacXSecData = nullptr; // [2xfELossEnergyGridSize x fNumMaterials]
 /// @} */ // end: macroscopic first transport cross section
 
+  /**
+   * @name Urban msc step limit and angular deflection related data members (optional, see G4HepEmParameters::fUseUMSCCorrectionTables):
+   * These members store the energy dependent, per material factors of the Urban
+   * msc model that are otherwise evaluated at each step. They are tabulated over
+   * the same energy grid as the energy loss data and stored, for each material,
+   * in the same format as the first transport cross section data above (i.e.
+   * value and second derivative pairs for spline interpolation, the data of the
+   * material with index \f$\texttt{im}\f$ starts at \f$2\times\f$G4HepEmElectronData::fELossEnergyGridSize\f$\times\texttt{im}\f$).
+   */
+///@{
+  /** The inverse of the ratio of the minimum true step limit to the first transport
+   *  mean free path (see G4HepEmElectronInteractionUMSC::ComputeTlimitMinFactor).*/
+  G4double*    fUMSCTlimitMinData = nullptr;  // [2xfELossEnergyGridSize x fNumMaterials]
+  /** The \f$e^+\f$ correction to theta0, as a function of the (geometric) mean
+   *  kinetic energy of the step (see G4HepEmElectronInteractionUMSC::Theta0PositronCorrection).
+   *  Only for \f$e^+\f$: nullptr in case of \f$e^-\f$.*/
+  G4double*    fUMSCTheta0CorrData = nullptr; // [2xfELossEnergyGridSize x fNumMaterials]
+/// @} */ // end: Urban msc
+
+  /**
+   * @name Urban msc angular distribution tables (optional, see G4HepEmParameters::fUseUMSCAngularTables):
+   * The distribution of \f$\mu = [1-\cos(\theta)]/2\f$ of the Urban msc model is
+   * tabulated for each material over a (log-spaced) kinetic energy and a (log-spaced)
+   * \f$\tau = t/\lambda_{tr1}\f$ step length grids (the steps are assumed to be without energy
+   * loss and not extremely small). Each table stores the \f$\mu/\tau\f$ values at the
+   * \f$u_k = 1-[1-k/(K-1)]^4,\,k=1,\ldots,K-1\f$ quantiles (i.e. denser at the tail) of the
+   * distribution with \f$K=\f$ G4HepEmElectronData::fUMSCAngularNumPoints. The first value of
+   * each table (\f$\mu=0\f$ at \f$u_0=0\f$ is implicit) is a flag that is 1 if the simple (two
+   * model functions) distribution is used and 0 otherwise: the model changes discontinuously
+   * so the tables are not used when this differs at the two neighbouring \f$\tau\f$ grid
+   * points (the analytic sampling is used in that case). At run-time, one of the two
+   * neighbouring energy tables is selected (statistical interpolation) while the scaled
+   * quantiles are interpolated linearly in \f$\ln(\tau)\f$ (see
+   * G4HepEmElectronInteractionUMSC::SampleCosineThetaTable).
+   * The table for material index \f$\texttt{im}\f$, energy index \f$i\f$ and \f$\tau\f$ index
+   * \f$j\f$ starts at \f$[(\texttt{im}\times N_E + i)\times N_{\tau} + j]\times K\f$.
+   */
+///@{
+  /** Number of kinetic energy grid points (zero if the tables are not built).*/
+  int          fUMSCAngularNumEkin = 0;
+  /** Logarithm of the first kinetic energy grid point.*/
+  G4double     fUMSCAngularLogMinEkin = 0.0;
+  /** Inverse of the log-spacing of the kinetic energy grid.*/
+  G4double     fUMSCAngularEILDelta = 0.0;
+  /** Number of \f$\tau\f$ grid points.*/
+  int          fUMSCAngularNumTau = 0;
+  /** Logarithm of the first \f$\tau\f$ grid point.*/
+  G4double     fUMSCAngularLogMinTau = 0.0;
+  /** Inverse of the log-spacing of the \f$\tau\f$ grid.*/
+  G4double     fUMSCAngularTauILDelta = 0.0;
+  /** Number of quantiles (\f$K\f$) stored in each table.*/
+  int          fUMSCAngularNumPoints = 0;
+  /** The tables for all materials.*/
+  G4double*    fUMSCAngularData = nullptr; // [fNumMaterials x fUMSCAngularNumEkin x fUMSCAngularNumTau x fUMSCAngularNumPoints]
+/// @} */ // end: Urban msc angular distribution tables
+
+  /**
+   * @name Relativistic bremsstrahlung rejection envelope (optional, see G4HepEmParameters::fUseRBBremEnvelopeTables):
+   * The energy transferred to the photon in the relativistic bremsstrahlung model is
+   * sampled by rejection in the \f$x = \ln(k^2+k_p^2)\f$ transformed variable, that is
+   * uniform over \f$[\ln(k_c^2+k_p^2), \ln(E^2+k_p^2)]\f$ (see
+   * G4HepEmElectronInteractionBrem::SampleETransferRB). Instead of the single maximum
+   * of the rejection function, a piecewise constant envelope is stored over \f$M=\f$
+   * G4HepEmElectronData::fBremRBEnvNumBins equal bins of this range for each material - cuts
+   * couple, element of its material and point of a (log-spaced) primary kinetic energy grid.
+   * The values are the bin-wise maxima of the rejection function, relative to its single
+   * maximum, increased by a small safety margin (and limited to 1). At run-time, the maximum
+   * of the envelopes at the two neighbouring kinetic energy grid points is used.
+   * The envelope of the material - cuts couple with index \f$\texttt{imc}\f$, for its element with
+   * index \f$j\f$ and kinetic energy index \f$i\f$ starts at
+   * \f$\texttt{fBremRBEnvStartIndexPerMatCut[imc]} + (j\times N_E + i)\times M\f$
+   * (couples of the same material and secondary gamma production cut share the same data).
+   */
+///@{
+  /** Number of kinetic energy grid points (zero if the envelopes are not built).*/
+  int          fBremRBEnvNumEkin = 0;
+  /** Logarithm of the first kinetic energy grid point.*/
+  G4double     fBremRBEnvLogMinEkin = 0.0;
+  /** Inverse of the log-spacing of the kinetic energy grid.*/
+  G4double     fBremRBEnvEILDelta = 0.0;
+  /** Number of envelope bins (\f$M\f$).*/
+  int          fBremRBEnvNumBins = 0;
+  /** Total number of envelope data.*/
+  int          fBremRBEnvNumData = 0;
+  /** Indices, at which data starts for a given material - cuts couple.*/
+  int*         fBremRBEnvStartIndexPerMatCut = nullptr;   // [fNumMatCuts]
+  /** The envelopes for all material - cuts couples.*/
+  G4double*    fBremRBEnvData = nullptr;                  // [fBremRBEnvNumData]
+/// @} */ // end: relativistic bremsstrahlung rejection envelope
+
+  /**
+   * @name Moller/Bhabha energy transfer inverse CDF tables (optional, see G4HepEmParameters::fUseIoniInvCDFTables):
+   * The fractional energy transfer \f$x = T/E\f$ to the secondary electron in ionisation is
+   * sampled by rejection from the \f$1/x^2\f$ envelope over \f$[x_{min}=T_c/E, x_{max}]\f$ with
+   * \f$x_{max}=1/2\f$ (Moller) or \f$1\f$ (Bhabha) (see G4HepEmElectronInteractionIoni::SampleETransferMoller).
+   * These tables give the inverse CDF of the same distribution in the envelope variable
+   * \f$z \in [0,1]\f$, i.e. \f$x = x_{min}x_{max}/[x_{min}(1-z)+x_{max}z]\f$ (that is uniform under the
+   * envelope), at the \f$u_k = [k/(K-1)]^4,\,k=0,\ldots,K-1\f$ quantiles (i.e. denser at the high
+   * energy transfer tail) with \f$K=\f$ G4HepEmElectronData::fIoniInvCDFNumPoints. So the sampling
+   * is rejection free with a fixed number of operations (see
+   * G4HepEmElectronInteractionIoni::SampleETransferTable).
+   *
+   * The tables are built for each secondary electron production cut over a (log-spaced) primary
+   * kinetic energy grid that starts at the threshold (\f$2T_c\f$ for e- and \f$T_c\f$ for e+).
+   * Material - cuts couples with the same cut share the same data, that start at the index of
+   * \f$\texttt{iStart}=\texttt{fIoniInvCDFStartIndexPerMatCut[imc]}\f$ with
+   *   - ``[0]``: \f$N_E\f$ number of kinetic energy grid points
+   *   - ``[1]``: \f$\log(E_0)\f$
+   *   - ``[2]``: \f$1/[\log(E_{N_E-1}/E_0)/(N_E-1)]\f$
+   *   - ``[3 + i\times K + k]``: \f$z\f$ at the \f$u_k\f$ quantile at the \f$E_i\f$ kinetic energy
+   *
+   * At run-time, one of the two neighbouring energy tables is selected (statistical interpolation).
+   */
+///@{
+  /** Number of quantiles (\f$K\f$) stored in each table (zero if the tables are not built).*/
+  int          fIoniInvCDFNumPoints = 0;
+  /** Total number of inverse CDF data.*/
+  int          fIoniInvCDFNumData = 0;
+  /** Indices, at which data starts for a given material - cuts couple.*/
+  int*         fIoniInvCDFStartIndexPerMatCut = nullptr;   // [fNumMatCuts]
+  /** The tables for all secondary electron production cuts.*/
+  G4double*    fIoniInvCDFData = nullptr;                  // [fIoniInvCDFNumData]
+/// @} */ // end: Moller/Bhabha energy transfer inverse CDF tables
+
 
 //// === TARGET ELEMENT SELECTOR
   /**
@@ -318,6 +443,7 @@ struct G4HepEmElectronData {
    * The implementations of the individual interaction models, that utilise these data for the run-time target atom selection (if needed), make sure that this
    * memory layout is maximally exploited. These ensure the optimal performance, both in terms of memory consumption and speed, when
    * accessing these data performing the correspondign \f$e^-/e^+\f$ interactions.
+   * Material - cuts couples with identical element selector data share the same (single copy of the) data, i.e. have the same start index.
    */
 ///@{
   /** Total number of element selector data for the Moller-Bhabha model for e-/e+ ionisation.*/
@@ -341,6 +467,30 @@ struct G4HepEmElectronData {
   /** Element selector data for all material - cuts couples with multiple element material.*/
   G4double*   fElemSelectorBremRBData = nullptr;                  // [fElemSelectorBremRBNumData]
 /// @} */ // end: target element selectors
+
+  /**
+   * @name Optional single precision copies of the run-time tables:
+   *
+   * Built only when G4HepEmParameters::fUseFloat32Tables is set (nullptr otherwise).
+   * They have exactly the same layout as the corresponding double precision
+   * arrays, but the energy loss, macroscopic cross section and element
+   * selector data are stored in `float` to halve the memory traffic of the
+   * run-time interpolations. The header fields of the restricted macroscopic
+   * cross section data (number of data, energy limits, etc.) are still read
+   * from the double precision array, and all interpolations accumulate in double.
+   */
+///@{
+  /** Single precision copy of G4HepEmElectronData::fELossData.*/
+  float*     fELossDataF32 = nullptr;                // [5xfELossEnergyGridSize x fNumMatCuts]
+  /** Single precision copy of G4HepEmElectronData::fResMacXSecData.*/
+  float*     fResMacXSecDataF32 = nullptr;           // [fResMacXSecNumData]
+  /** Single precision copy of G4HepEmElectronData::fTr1MacXSecData.*/
+  float*     fTr1MacXSecDataF32 = nullptr;           // [2xfELossEnergyGridSize x fNumMaterials]
+  /** Single precision copy of G4HepEmElectronData::fElemSelectorBremSBData.*/
+  float*     fElemSelectorBremSBDataF32 = nullptr;   // [fElemSelectorBremSBNumData]
+  /** Single precision copy of G4HepEmElectronData::fElemSelectorBremRBData.*/
+  float*     fElemSelectorBremRBDataF32 = nullptr;   // [fElemSelectorBremRBNumData]
+/// @} */ // end: single precision copies
 };
 
 
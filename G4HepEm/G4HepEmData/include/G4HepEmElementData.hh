@@ -60,6 +60,15 @@ struct G4HepEmElemData {
   /** \f$ \exp \left[ \frac{42.038-F_{\text{high}}}{8.29} \right] -0.958 \f$ with \f$ F_{\text{high}} = 8[\log(Z)/3 + f_C] \f$ */
   G4double  fDeltaMaxHigh = 0.0;
 
+  /** Bethe-Heitler conversion: \f$ 136 mc^2/Z^{1/3} \f$ i.e. \f$ \delta = \f$ `fDeltaFactorBH` \f$ / [E_{\gamma}\epsilon(1-\epsilon)] \f$ */
+  G4double  fDeltaFactorBH = 0.0;
+
+  /** Bethe-Heitler conversion: \f$ F(Z) \f$ below [0] and above [1] 50 MeV i.e. \f$ 8\ln(Z)/3 \f$ and \f$ 8[\ln(Z)/3 + f_C] \f$ */
+  G4double  fFZBH[2] = {0.0, 0.0};
+
+  /** Bethe-Heitler conversion: \f$ 1/\delta_{\text{max}} \f$ below [0] and above [1] 50 MeV i.e. 1/`fDeltaMaxLow` and 1/`fDeltaMaxHigh` */
+  G4double  fInvDeltaMaxBH[2] = {0.0, 0.0};
+
   /** LPM variable \f$ 1/ln [ \sqrt{2}s1 ] \f$ */
   G4double  fILVarS1 = 0.0;
 
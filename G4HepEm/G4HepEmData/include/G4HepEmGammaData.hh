@@ -10,7 +10,8 @@
  *
  * @brief All energy loss process related data used for \f$e^-/e+\f$ simulations by `G4HepEm`.
  *
- * Covers Gamma conversion itno e-/e+ pairs and Compton scattering at the moment.
+ * Covers Gamma conversion itno e-/e+ pairs, Compton scattering and the photoelectric
+ * effect at the moment.
  */
 
 struct G4HepEmGammaData {
@@ -43,6 +44,66 @@ struct G4HepEmGammaData {
 
   /** Element selector data for all materials */
   G4double*       fElemSelectorConvData = nullptr;             // [fElemSelectorConvNumData]
+
+//// === photoelectric related data. Lookup grid: 208 bins (16 per decades) from 10 eV - 100 TeV
+  // The macroscopic cross section is computed from the Sandia parametrisation of
+  // the material. The energy knots of a material are the union of the lookup grid
+  // and all (material and element) Sandia absorption edges. Each knot stores the
+  // Sandia coefficients valid above the knot and the (normalised, cumulative)
+  // element selector at its both ends. The knot of a given energy is found by
+  // an O(1) lookup on the (uniform) log-energy grid.
+  const int     fPEEnergyGridSize = 209;
+  G4double        fPELogMinEkin = 0.0;     // = -11.512925464970229; // log(0.00001) i.e. log(10 eV)
+  G4double        fPEEILDelta = 0.0;       // =  7.527771019656365;  // 1./[log(emax/emin)/208]
+  int           fPENumData = 0;            // total number of data i.e. lenght of fPEData
+  int*          fPEStartIndexPerMat = nullptr;   // [fNumMaterials]
+  // Index of the knot (local to the material) that is the last one below the
+  // lower edge of each bin of the lookup grid.
+  int*          fPEBinKnotIndex = nullptr;       // [fNumMaterials*(fPEEnergyGridSize-1)]
+
+  /** Photoelectric knot data for all materials: for each material #knots, #elements
+    * then for each knot [E, 4 Sandia coefficients, (#elements-1) cumulatives at E,
+    * (#elements-1) cumulatives at the next knot] (no cumulatives for single element
+    * materials).*/
+  G4double*       fPEData = nullptr;               // [fPENumData]
+
+//// === fused macroscopic cross section table (optional, see G4HepEmParameters::fGammaXSecTableLayout)
+  // Conversion, Compton, photoelectric and total macroscopic cross sections stored
+  // interleaved at each knot of a common log-energy grid from 100 eV - 100 TeV.
+  // Linear interpolation in log-energy: the absorption edges are smeared within
+  // one bin of this grid.
+  int           fFusedEnergyGridSize = 0;
+  G4double        fFusedLogMinEkin = 0.0;
+  G4double        fFusedEILDelta = 0.0;
+  G4double*       fFusedEnergyGrid = nullptr;      // [fFusedEnergyGridSize]
+  G4double*       fFusedMacXsecData = nullptr;     // [fNumMaterials*fFusedEnergyGridSize*4]
+
+//// === LPM functions for conversion (optional, see G4HepEmParameters::fUseLPMFunctionTables)
+  // In conversion, the LPM functions xi(s), G(s) and phi(s) of a given element
+  // depend only on w = s'^2 = E_lpm/[8 E_g eps(1-eps)]. They are tabulated
+  // (interleaved) for each element (Z) used in the geometry. Grid: 500 bins (50
+  // per decades) from w = 1E-4 - 1E+6.
+  const int     fConvLPMGridSize = 501;
+  G4double        fConvLPMLogMinVar = 0.0;   // = -9.210340371976182; // log(1E-4)
+  G4double        fConvLPMILDelta = 0.0;     // = 21.714724095162590; // 1./[log(wmax/wmin)/500]
+  int           fConvLPMMaxZet = 0;        // maximum Z with LPM function table
+  int           fConvLPMNumData = 0;       // total number of data i.e. lenght of fConvLPMData
+  int*          fConvLPMStartIndexPerZ = nullptr;  // [fConvLPMMaxZet+1] (-1 if no table for Z)
+  G4double*       fConvLPMData = nullptr;            // [fConvLPMNumData]
+
+//// === Klein-Nishina inverse CDF for Compton (optional, see G4HepEmParameters::fUseCompInvCDFTables)
+  // At each kinetic energy of the Compton grid (fCompEnergyGrid) the inverse CDF
+  // of the transformed variable t = ln(eps)/ln(eps_0) in [0,1] (eps is the reduced
+  // post interaction photon energy and eps_0 = 1/(1+2k) its minimum) is stored
+  // at fCompInvCDFNumPoints equally spaced values of the CDF in [0,1].
+  int           fCompInvCDFNumPoints = 0;
+  G4double*       fCompInvCDFData = nullptr;         // [fCompEnergyGridSize*fCompInvCDFNumPoints]
+
+//// === single precision copies of the tables (optional, see G4HepEmParameters::fUseFloat32Tables)
+  // The same layout as the corresponding double precision arrays (interpolation
+  // still accumulates in double).
+  float*        fConvCompMacXsecDataF32 = nullptr;   // [#materials*2*(fConvEnergyGridSize+fCompEnergyGridSize)]
+  float*        fElemSelectorConvDataF32 = nullptr;  // [fElemSelectorConvNumData]
 };
 
 /**
@@ -55,6 +55,48 @@ struct G4HepEmParameters {
   G4double fMSCRangeFactor;
   G4double fMSCSafetyFactor;
 
+  /** Layout of the \f$\gamma\f$ macroscopic cross section tables used at run-time:
+    * `0` (default) separate conversion, Compton and photoelectric tables or `1` an
+    * additional fused table that stores the conversion, Compton, photoelectric and
+    * total macroscopic cross sections interleaved at each knot of a common grid.*/
+  int    fGammaXSecTableLayout;
+  /** Number of bins per decade (equally spaced on log scale) of the kinetic energy grid
+    * of the fused \f$\gamma\f$ macroscopic cross section table.*/
+  int    fNumGammaFusedTableBinsPerDecade;
+
+  /** Use the tabulated (default) or the analytic (e.g. for validation) LPM suppression
+    * functions in the \f$\gamma\f$ conversion interaction.*/
+  bool   fUseLPMFunctionTables;
+
+  /** Build (and use at run-time) single precision copies of the energy loss,
+    * macroscopic cross section and target element selector tables (interpolation
+    * still accumulates in double). Not supported in the AD (CoDiPack) builds.*/
+  bool   fUseFloat32Tables;
+
+  /** Build (and use at run-time) the tabulated Urban msc angular distributions
+    * instead of the analytic sampling (see G4HepEmElectronData::fUMSCAngularData).*/
+  bool   fUseUMSCAngularTables;
+
+  /** Build (and use at run-time) the tabulated, energy dependent Urban msc
+    * minimum step limit and e+ theta0 correction factors instead of their
+    * analytic evaluation (see G4HepEmElectronData::fUMSCTlimitMinData).*/
+  bool   fUseUMSCCorrectionTables;
+
+  /** Build (and use at run-time) the piecewise constant rejection envelopes of
+    * the relativistic bremsstrahlung energy transfer sampling instead of its
+    * single maximum (see G4HepEmElectronData::fBremRBEnvData).*/
+  bool   fUseRBBremEnvelopeTables;
+
+  /** Build (and use at run-time) the inverse CDF tables of the Moller/Bhabha
+    * energy transfer instead of the rejection sampling (see
+    * G4HepEmElectronData::fIoniInvCDFData).*/
+  bool   fUseIoniInvCDFTables;
+
+  /** Build (and use at run-time) the inverse CDF tables of the Klein-Nishina
+    * reduced photon energy in Compton scattering instead of the rejection
+    * sampling (see G4HepEmGammaData::fCompInvCDFData).*/
+  bool   fUseCompInvCDFTables;
+
 };
 
 #endif // G4HepEmParameters_HH
@@ -2,6 +2,12 @@
 
 #include "G4HepEmData.hh"
 #include <iostream>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
 
 #include "G4HepEmMatCutData.hh"
 #include "G4HepEmMaterialData.hh"
@@ -72,6 +78,172 @@ void FreeG4HepEmData (struct G4HepEmData* theHepEmData) {
 #endif // G4HepEm_CUDA_BUILD
 }
 
+
+// === Host side replicas of the large, read-only run-time data arrays.
+#if !(defined(CODI_FORWARD) || defined(CODI_REVERSE))
+namespace {
+  const std::size_t kHugePageSize  = 2*1024*1024;
+  const std::size_t kCacheLineSize = 64;
+
+  // Copies the `num` values of `data` into a new array that is written (first
+  // touched) by the calling thread. Arrays larger than a huge page are 2 MB
+  // aligned and advised to be backed by transparent huge pages if requested.
+  template <typename T>
+  T* ReplicateArray(const T* data, int num, bool useHugePages) {
+    if (data == nullptr || num < 1) {
+      return nullptr;
+    }
+    const std::size_t numBytes = sizeof(T)*num;
+    const std::size_t align    = (useHugePages && numBytes >= kHugePageSize) ? kHugePageSize : kCacheLineSize;
+    const std::size_t size     = ((numBytes + align - 1)/align)*align;
+    void* mem = std::aligned_alloc(align, size);
+    if (mem == nullptr) {
+      std::cerr << " **** ERROR in MakeG4HepEmDataReplica: cannot allocate " << size << " bytes" << std::endl;
+      exit(-1);
+    }
+#ifdef __linux__
+    if (align == kHugePageSize) {
+      // only an advice: silently ignored if transparent huge pages are disabled
+      madvise(mem, size, MADV_HUGEPAGE);
+    }
+#endif
+    std::memcpy(mem, data, numBytes);
+    return static_cast<T*>(mem);
+  }
+
+  G4HepEmElectronData* ReplicateElectronData(const G4HepEmElectronData* onHost, bool useHugePages) {
+    if (onHost == nullptr) {
+      return nullptr;
+    }
+    G4HepEmElectronData* rep = new G4HepEmElectronData(*onHost);
+    const int numELossData   = 5*onHost->fELossEnergyGridSize*onHost->fNumMatCuts;
+    const int numTr1MacXSecs = 2*onHost->fELossEnergyGridSize*onHost->fNumMaterials;
+    rep->fELossData              = ReplicateArray(onHost->fELossData, numELossData, useHugePages);
+    rep->fResMacXSecData         = ReplicateArray(onHost->fResMacXSecData, onHost->fResMacXSecNumData, useHugePages);
+    rep->fTr1MacXSecData         = ReplicateArray(onHost->fTr1MacXSecData, numTr1MacXSecs, useHugePages);
+    rep->fElemSelectorIoniData   = ReplicateArray(onHost->fElemSelectorIoniData, onHost->fElemSelectorIoniNumData, useHugePages);
+    rep->fElemSelectorBremSBData = ReplicateArray(onHost->fElemSelectorBremSBData, onHost->fElemSelectorBremSBNumData, useHugePages);
+    rep->fElemSelectorBremRBData = ReplicateArray(onHost->fElemSelectorBremRBData, onHost->fElemSelectorBremRBNumData, useHugePages);
+    rep->fUMSCAngularData        = ReplicateArray(onHost->fUMSCAngularData, onHost->fNumMaterials*onHost->fUMSCAngularNumEkin*onHost->fUMSCAngularNumTau*onHost->fUMSCAngularNumPoints, useHugePages);
+    rep->fBremRBEnvData          = ReplicateArray(onHost->fBremRBEnvData, onHost->fBremRBEnvNumData, useHugePages);
+    rep->fIoniInvCDFData         = ReplicateArray(onHost->fIoniInvCDFData, onHost->fIoniInvCDFNumData, useHugePages);
+    // the optional single precision copies (if any)
+    rep->fELossDataF32              = ReplicateArray(onHost->fELossDataF32, numELossData, useHugePages);
+    rep->fResMacXSecDataF32         = ReplicateArray(onHost->fResMacXSecDataF32, onHost->fResMacXSecNumData, useHugePages);
+    rep->fTr1MacXSecDataF32         = ReplicateArray(onHost->fTr1MacXSecDataF32, numTr1MacXSecs, useHugePages);
+    rep->fElemSelectorBremSBDataF32 = ReplicateArray(onHost->fElemSelectorBremSBDataF32, onHost->fElemSelectorBremSBNumData, useHugePages);
+    rep->fElemSelectorBremRBDataF32 = ReplicateArray(onHost->fElemSelectorBremRBDataF32, onHost->fElemSelectorBremRBNumData, useHugePages);
+    return rep;
+  }
+
+  void FreeElectronDataReplica(G4HepEmElectronData** rep) {
+    if (*rep == nullptr) {
+      return;
+    }
+    std::free((*rep)->fELossData);
+    std::free((*rep)->fResMacXSecData);
+    std::free((*rep)->fTr1MacXSecData);
+    std::free((*rep)->fElemSelectorIoniData);
+    std::free((*rep)->fElemSelectorBremSBData);
+    std::free((*rep)->fElemSelectorBremRBData);
+    std::free((*rep)->fUMSCAngularData);
+    std::free((*rep)->fBremRBEnvData);
+    std::free((*rep)->fIoniInvCDFData);
+    std::free((*rep)->fELossDataF32);
+    std::free((*rep)->fResMacXSecDataF32);
+    std::free((*rep)->fTr1MacXSecDataF32);
+    std::free((*rep)->fElemSelectorBremSBDataF32);
+    std::free((*rep)->fElemSelectorBremRBDataF32);
+    delete *rep;
+    *rep = nullptr;
+  }
+
+  G4HepEmSBTableData* ReplicateSBTableData(const G4HepEmSBTableData* onHost, bool useHugePages) {
+    if (onHost == nullptr) {
+      return nullptr;
+    }
+    G4HepEmSBTableData* rep = new G4HepEmSBTableData(*onHost);
+    rep->fSBTableData = ReplicateArray(onHost->fSBTableData, onHost->fNumSBTableData, useHugePages);
+    return rep;
+  }
+
+  void FreeSBTableDataReplica(G4HepEmSBTableData** rep) {
+    if (*rep == nullptr) {
+      return;
+    }
+    std::free((*rep)->fSBTableData);
+    delete *rep;
+    *rep = nullptr;
+  }
+
+  G4HepEmGammaData* ReplicateGammaData(const G4HepEmGammaData* onHost, bool useHugePages) {
+    if (onHost == nullptr) {
+      return nullptr;
+    }
+    G4HepEmGammaData* rep = new G4HepEmGammaData(*onHost);
+    const int numConvCompData = onHost->fNumMaterials*2*(onHost->fConvEnergyGridSize+onHost->fCompEnergyGridSize);
+    const int numFusedData    = onHost->fNumMaterials*onHost->fFusedEnergyGridSize*4;
+    rep->fConvCompMacXsecData     = ReplicateArray(onHost->fConvCompMacXsecData, numConvCompData, useHugePages);
+    rep->fElemSelectorConvData    = ReplicateArray(onHost->fElemSelectorConvData, onHost->fElemSelectorConvNumData, useHugePages);
+    rep->fPEData                  = ReplicateArray(onHost->fPEData, onHost->fPENumData, useHugePages);
+    rep->fFusedMacXsecData        = ReplicateArray(onHost->fFusedMacXsecData, numFusedData, useHugePages);
+    rep->fCompInvCDFData          = ReplicateArray(onHost->fCompInvCDFData, onHost->fCompEnergyGridSize*onHost->fCompInvCDFNumPoints, useHugePages);
+    rep->fConvCompMacXsecDataF32  = ReplicateArray(onHost->fConvCompMacXsecDataF32, numConvCompData, useHugePages);
+    rep->fElemSelectorConvDataF32 = ReplicateArray(onHost->fElemSelectorConvDataF32, onHost->fElemSelectorConvNumData, useHugePages);
+    return rep;
+  }
+
+  void FreeGammaDataReplica(G4HepEmGammaData** rep) {
+    if (*rep == nullptr) {
+      return;
+    }
+    std::free((*rep)->fConvCompMacXsecData);
+    std::free((*rep)->fElemSelectorConvData);
+    std::free((*rep)->fPEData);
+    std::free((*rep)->fFusedMacXsecData);
+    std::free((*rep)->fCompInvCDFData);
+    std::free((*rep)->fConvCompMacXsecDataF32);
+    std::free((*rep)->fElemSelectorConvDataF32);
+    delete *rep;
+    *rep = nullptr;
+  }
+}
+
+struct G4HepEmData* MakeG4HepEmDataReplica (const struct G4HepEmData* theHepEmData, bool useHugePages) {
+  if (theHepEmData == nullptr) {
+    return nullptr;
+  }
+  // shallow copy: the global material, material-cuts and element data are shared
+  G4HepEmData* rep = new G4HepEmData(*theHepEmData);
+  rep->fTheElectronData = ReplicateElectronData(theHepEmData->fTheElectronData, useHugePages);
+  rep->fThePositronData = ReplicateElectronData(theHepEmData->fThePositronData, useHugePages);
+  rep->fTheSBTableData  = ReplicateSBTableData(theHepEmData->fTheSBTableData, useHugePages);
+  rep->fTheGammaData    = ReplicateGammaData(theHepEmData->fTheGammaData, useHugePages);
+  return rep;
+}
+
+void FreeG4HepEmDataReplica (struct G4HepEmData** theReplica) {
+  if (*theReplica == nullptr) {
+    return;
+  }
+  FreeElectronDataReplica ( &((*theReplica)->fTheElectronData) );
+  FreeElectronDataReplica ( &((*theReplica)->fThePositronData) );
+  FreeSBTableDataReplica  ( &((*theReplica)->fTheSBTableData)  );
+  FreeGammaDataReplica    ( &((*theReplica)->fTheGammaData)    );
+  delete *theReplica;
+  *theReplica = nullptr;
+}
+#else
+struct G4HepEmData* MakeG4HepEmDataReplica (const struct G4HepEmData*, bool) {
+  return nullptr;
+}
+
+void FreeG4HepEmDataReplica (struct G4HepEmData** theReplica) {
+  *theReplica = nullptr;
+}
+#endif // !(defined(CODI_FORWARD) || defined(CODI_REVERSE))
+
+
 #ifdef G4HepEm_CUDA_BUILD
 #include <cuda_runtime.h>
 #include "G4HepEmCuUtils.hh"
@@ -23,6 +23,13 @@ void FreeElectronData (struct G4HepEmElectronData** theElectronData)  {
     delete[] (*theElectronData)->fELossData;
     delete[] (*theElectronData)->fResMacXSecData;
     delete[] (*theElectronData)->fTr1MacXSecData;
+    delete[] (*theElectronData)->fUMSCTlimitMinData;
+    delete[] (*theElectronData)->fUMSCTheta0CorrData;
+    delete[] (*theElectronData)->fUMSCAngularData;
+    delete[] (*theElectronData)->fBremRBEnvStartIndexPerMatCut;
+    delete[] (*theElectronData)->fBremRBEnvData;
+    delete[] (*theElectronData)->fIoniInvCDFStartIndexPerMatCut;
+    delete[] (*theElectronData)->fIoniInvCDFData;
     delete[] (*theElectronData)->fResMacXSecStartIndexPerMatCut;
     delete[] (*theElectronData)->fElemSelectorIoniStartIndexPerMatCut;
     delete[] (*theElectronData)->fElemSelectorIoniData;
@@ -30,6 +37,11 @@ void FreeElectronData (struct G4HepEmElectronData** theElectronData)  {
     delete[] (*theElectronData)->fElemSelectorBremSBData;
     delete[] (*theElectronData)->fElemSelectorBremRBStartIndexPerMatCut;
     delete[] (*theElectronData)->fElemSelectorBremRBData;
+    delete[] (*theElectronData)->fELossDataF32;
+    delete[] (*theElectronData)->fResMacXSecDataF32;
+    delete[] (*theElectronData)->fTr1MacXSecDataF32;
+    delete[] (*theElectronData)->fElemSelectorBremSBDataF32;
+    delete[] (*theElectronData)->fElemSelectorBremRBDataF32;
 
     delete *theElectronData;
     *theElectronData = nullptr;
@@ -83,6 +95,22 @@ void CopyElectronDataToDevice(struct G4HepEmElectronData* onHOST, struct G4HepEm
   gpuErrchk ( cudaMalloc ( &(elDataHTo_d->fTr1MacXSecData), sizeof( G4double ) * numTr1MacXSecs ) );
   gpuErrchk ( cudaMemcpy (   elDataHTo_d->fTr1MacXSecData,  onHOST->fTr1MacXSecData, sizeof( G4double ) * numTr1MacXSecs,  cudaMemcpyHostToDevice ) ); 
   //
+  // === Urban msc step limit and theta0 correction data (if any):
+  //
+  if (onHOST->fUMSCTlimitMinData != nullptr) {
+    gpuErrchk ( cudaMalloc ( &(elDataHTo_d->fUMSCTlimitMinData), sizeof( G4double ) * numTr1MacXSecs ) );
+    gpuErrchk ( cudaMemcpy (   elDataHTo_d->fUMSCTlimitMinData,  onHOST->fUMSCTlimitMinData, sizeof( G4double ) * numTr1MacXSecs,  cudaMemcpyHostToDevice ) );
+  }
+  if (onHOST->fUMSCTheta0CorrData != nullptr) {
+    gpuErrchk ( cudaMalloc ( &(elDataHTo_d->fUMSCTheta0CorrData), sizeof( G4double ) * numTr1MacXSecs ) );
+    gpuErrchk ( cudaMemcpy (   elDataHTo_d->fUMSCTheta0CorrData,  onHOST->fUMSCTheta0CorrData, sizeof( G4double ) * numTr1MacXSecs,  cudaMemcpyHostToDevice ) );
+  }
+  if (onHOST->fUMSCAngularData != nullptr) {
+    const int numUMSCAngularData = numHepEmMats*onHOST->fUMSCAngularNumEkin*onHOST->fUMSCAngularNumTau*onHOST->fUMSCAngularNumPoints;
+    gpuErrchk ( cudaMalloc ( &(elDataHTo_d->fUMSCAngularData), sizeof( G4double ) * numUMSCAngularData ) );
+    gpuErrchk ( cudaMemcpy (   elDataHTo_d->fUMSCAngularData,  onHOST->fUMSCAngularData, sizeof( G4double ) * numUMSCAngularData,  cudaMemcpyHostToDevice ) );
+  }
+  //
   //  === Target element selector data (for ioni and brem EM models)
   //
   // allocate memory for Ionisation related data on the _d and copy form _h
@@ -119,6 +147,53 @@ void CopyElectronDataToDevice(struct G4HepEmElectronData* onHOST, struct G4HepEm
     elDataHTo_d->fElemSelectorBremRBData = nullptr;
   }
   //
+  // === Relativistic brem rejection envelopes (if any)
+  //
+  const int numBremRBEnvData = onHOST->fBremRBEnvData != nullptr ? onHOST->fBremRBEnvNumData : 0;
+  if (numBremRBEnvData > 0) {
+    gpuErrchk ( cudaMalloc ( &(elDataHTo_d->fBremRBEnvStartIndexPerMatCut), sizeof( int )    * numHepEmMatCuts  ) );
+    gpuErrchk ( cudaMalloc ( &(elDataHTo_d->fBremRBEnvData),                sizeof( G4double ) * numBremRBEnvData ) );
+    gpuErrchk ( cudaMemcpy (   elDataHTo_d->fBremRBEnvStartIndexPerMatCut,  onHOST->fBremRBEnvStartIndexPerMatCut, sizeof( int )    * numHepEmMatCuts,  cudaMemcpyHostToDevice ) );
+    gpuErrchk ( cudaMemcpy (   elDataHTo_d->fBremRBEnvData,                 onHOST->fBremRBEnvData,                sizeof( G4double ) * numBremRBEnvData, cudaMemcpyHostToDevice ) );
+  } else {
+    elDataHTo_d->fBremRBEnvStartIndexPerMatCut = nullptr;
+    elDataHTo_d->fBremRBEnvData = nullptr;
+  }
+  //
+  // === Moller/Bhabha energy transfer inverse CDF tables (if any)
+  //
+  const int numIoniInvCDFData = onHOST->fIoniInvCDFData != nullptr ? onHOST->fIoniInvCDFNumData : 0;
+  if (numIoniInvCDFData > 0) {
+    gpuErrchk ( cudaMalloc ( &(elDataHTo_d->fIoniInvCDFStartIndexPerMatCut), sizeof( int )    * numHepEmMatCuts   ) );
+    gpuErrchk ( cudaMalloc ( &(elDataHTo_d->fIoniInvCDFData),                sizeof( G4double ) * numIoniInvCDFData ) );
+    gpuErrchk ( cudaMemcpy (   elDataHTo_d->fIoniInvCDFStartIndexPerMatCut,  onHOST->fIoniInvCDFStartIndexPerMatCut, sizeof( int )    * numHepEmMatCuts,   cudaMemcpyHostToDevice ) );
+    gpuErrchk ( cudaMemcpy (   elDataHTo_d->fIoniInvCDFData,                 onHOST->fIoniInvCDFData,                sizeof( G4double ) * numIoniInvCDFData, cudaMemcpyHostToDevice ) );
+  } else {
+    elDataHTo_d->fIoniInvCDFStartIndexPerMatCut = nullptr;
+    elDataHTo_d->fIoniInvCDFData = nullptr;
+  }
+  //
+  // === Optional single precision copies of the tables (if any)
+  //
+  if (onHOST->fELossDataF32 != nullptr) {
+    const int numBremSBDataF32 = onHOST->fElemSelectorBremSBDataF32 != nullptr ? numBremSBData : 0;
+    const int numBremRBDataF32 = onHOST->fElemSelectorBremRBDataF32 != nullptr ? numBremRBData : 0;
+    gpuErrchk ( cudaMalloc ( &(elDataHTo_d->fELossDataF32),       sizeof( float ) * numELossData   ) );
+    gpuErrchk ( cudaMalloc ( &(elDataHTo_d->fResMacXSecDataF32),  sizeof( float ) * numResMacXSecs ) );
+    gpuErrchk ( cudaMalloc ( &(elDataHTo_d->fTr1MacXSecDataF32),  sizeof( float ) * numTr1MacXSecs ) );
+    gpuErrchk ( cudaMemcpy (   elDataHTo_d->fELossDataF32,        onHOST->fELossDataF32,       sizeof( float ) * numELossData,   cudaMemcpyHostToDevice ) );
+    gpuErrchk ( cudaMemcpy (   elDataHTo_d->fResMacXSecDataF32,   onHOST->fResMacXSecDataF32,  sizeof( float ) * numResMacXSecs, cudaMemcpyHostToDevice ) );
+    gpuErrchk ( cudaMemcpy (   elDataHTo_d->fTr1MacXSecDataF32,   onHOST->fTr1MacXSecDataF32,  sizeof( float ) * numTr1MacXSecs, cudaMemcpyHostToDevice ) );
+    if (numBremSBDataF32 > 0) {
+      gpuErrchk ( cudaMalloc ( &(elDataHTo_d->fElemSelectorBremSBDataF32), sizeof( float ) * numBremSBDataF32 ) );
+      gpuErrchk ( cudaMemcpy (   elDataHTo_d->fElemSelectorBremSBDataF32,  onHOST->fElemSelectorBremSBDataF32, sizeof( float ) * numBremSBDataF32, cudaMemcpyHostToDevice ) );
+    }
+    if (numBremRBDataF32 > 0) {
+      gpuErrchk ( cudaMalloc ( &(elDataHTo_d->fElemSelectorBremRBDataF32), sizeof( float ) * numBremRBDataF32 ) );
+      gpuErrchk ( cudaMemcpy (   elDataHTo_d->fElemSelectorBremRBDataF32,  onHOST->fElemSelectorBremRBDataF32, sizeof( float ) * numBremRBDataF32, cudaMemcpyHostToDevice ) );
+    }
+  }
+  //
   // Finaly copy the top level, i.e. the main struct with the already
   // appropriate pointers to device side memory locations but stored on the host
   gpuErrchk ( cudaMalloc (  onDEVICE,              sizeof(  struct G4HepEmElectronData ) ) );
@@ -142,6 +217,16 @@ void FreeElectronDataOnDevice(struct G4HepEmElectronData** onDEVICE) {
     cudaFree( onHostTo_d->fResMacXSecData                );
     // Tr1-mxsec data
     cudaFree( onHostTo_d->fTr1MacXSecData                );
+    // Urban msc data
+    cudaFree( onHostTo_d->fUMSCTlimitMinData             );
+    cudaFree( onHostTo_d->fUMSCTheta0CorrData            );
+    cudaFree( onHostTo_d->fUMSCAngularData               );
+    // Relativistic brem rejection envelopes
+    cudaFree( onHostTo_d->fBremRBEnvStartIndexPerMatCut  );
+    cudaFree( onHostTo_d->fBremRBEnvData                 );
+    // Moller/Bhabha energy transfer inverse CDF tables
+    cudaFree( onHostTo_d->fIoniInvCDFStartIndexPerMatCut );
+    cudaFree( onHostTo_d->fIoniInvCDFData                );
     // Target element selectors for ioni and brem models
     cudaFree( onHostTo_d->fElemSelectorIoniStartIndexPerMatCut   );
     cudaFree( onHostTo_d->fElemSelectorIoniData                  );
@@ -149,6 +234,12 @@ void FreeElectronDataOnDevice(struct G4HepEmElectronData** onDEVICE) {
     cudaFree( onHostTo_d->fElemSelectorBremSBData                );
     cudaFree( onHostTo_d->fElemSelectorBremRBStartIndexPerMatCut );
     cudaFree( onHostTo_d->fElemSelectorBremRBData                );
+    // Optional single precision copies
+    cudaFree( onHostTo_d->fELossDataF32                          );
+    cudaFree( onHostTo_d->fResMacXSecDataF32                     );
+    cudaFree( onHostTo_d->fTr1MacXSecDataF32                     );
+    cudaFree( onHostTo_d->fElemSelectorBremSBDataF32             );
+    cudaFree( onHostTo_d->fElemSelectorBremRBDataF32             );
     //
     // free the remaining device side electron data and set the host side ptr to null
     cudaFree( *onDEVICE );
@@ -22,6 +22,16 @@ void FreeGammaData (struct G4HepEmGammaData** theGammaData)  {
     delete[] (*theGammaData)->fElemSelectorConvStartIndexPerMat;
     delete[] (*theGammaData)->fElemSelectorConvEgrid;
     delete[] (*theGammaData)->fElemSelectorConvData;
+    delete[] (*theGammaData)->fPEStartIndexPerMat;
+    delete[] (*theGammaData)->fPEBinKnotIndex;
+    delete[] (*theGammaData)->fPEData;
+    delete[] (*theGammaData)->fFusedEnergyGrid;
+    delete[] (*theGammaData)->fFusedMacXsecData;
+    delete[] (*theGammaData)->fConvLPMStartIndexPerZ;
+    delete[] (*theGammaData)->fConvLPMData;
+    delete[] (*theGammaData)->fCompInvCDFData;
+    delete[] (*theGammaData)->fConvCompMacXsecDataF32;
+    delete[] (*theGammaData)->fElemSelectorConvDataF32;
     delete *theGammaData;
     *theGammaData = nullptr;
   }
@@ -78,6 +88,65 @@ void CopyGammaDataToDevice(struct G4HepEmGammaData* onHOST, struct G4HepEmGammaD
     gmDataHTo_d->fElemSelectorConvData = nullptr;
   }
   //
+  // -- go for the photoelectric related data
+  int numPEDat = onHOST->fPENumData;
+  if (numPEDat > 0) {
+    int numPEBinData = numHepEmMat*(onHOST->fPEEnergyGridSize-1);
+    gpuErrchk ( cudaMalloc ( &(gmDataHTo_d->fPEStartIndexPerMat), sizeof( int ) * numHepEmMat ) );
+    gpuErrchk ( cudaMemcpy (   gmDataHTo_d->fPEStartIndexPerMat,  onHOST->fPEStartIndexPerMat, sizeof( int ) * numHepEmMat, cudaMemcpyHostToDevice ) );
+    gpuErrchk ( cudaMalloc ( &(gmDataHTo_d->fPEBinKnotIndex), sizeof( int ) * numPEBinData ) );
+    gpuErrchk ( cudaMemcpy (   gmDataHTo_d->fPEBinKnotIndex,  onHOST->fPEBinKnotIndex, sizeof( int ) * numPEBinData, cudaMemcpyHostToDevice ) );
+    gpuErrchk ( cudaMalloc ( &(gmDataHTo_d->fPEData), sizeof( G4double ) * numPEDat ) );
+    gpuErrchk ( cudaMemcpy (   gmDataHTo_d->fPEData,  onHOST->fPEData, sizeof( G4double ) * numPEDat, cudaMemcpyHostToDevice ) );
+  } else {
+    gmDataHTo_d->fPEStartIndexPerMat = nullptr;
+    gmDataHTo_d->fPEBinKnotIndex = nullptr;
+    gmDataHTo_d->fPEData = nullptr;
+  }
+  //
+  // -- go for the fused macroscopic cross section data (if any)
+  int numFusedE = onHOST->fFusedEnergyGridSize;
+  if (numFusedE > 0) {
+    int numFusedDat = numHepEmMat*numFusedE*4;
+    gpuErrchk ( cudaMalloc ( &(gmDataHTo_d->fFusedEnergyGrid), sizeof( G4double ) * numFusedE ) );
+    gpuErrchk ( cudaMemcpy (   gmDataHTo_d->fFusedEnergyGrid,  onHOST->fFusedEnergyGrid, sizeof( G4double ) * numFusedE, cudaMemcpyHostToDevice ) );
+    gpuErrchk ( cudaMalloc ( &(gmDataHTo_d->fFusedMacXsecData), sizeof( G4double ) * numFusedDat ) );
+    gpuErrchk ( cudaMemcpy (   gmDataHTo_d->fFusedMacXsecData,  onHOST->fFusedMacXsecData, sizeof( G4double ) * numFusedDat, cudaMemcpyHostToDevice ) );
+  } else {
+    gmDataHTo_d->fFusedEnergyGrid = nullptr;
+    gmDataHTo_d->fFusedMacXsecData = nullptr;
+  }
+  //
+  // -- go for the conversion LPM function tables (if any)
+  int numLPMDat = onHOST->fConvLPMNumData;
+  if (numLPMDat > 0) {
+    int numLPMZet = onHOST->fConvLPMMaxZet + 1;
+    gpuErrchk ( cudaMalloc ( &(gmDataHTo_d->fConvLPMStartIndexPerZ), sizeof( int ) * numLPMZet ) );
+    gpuErrchk ( cudaMemcpy (   gmDataHTo_d->fConvLPMStartIndexPerZ,  onHOST->fConvLPMStartIndexPerZ, sizeof( int ) * numLPMZet, cudaMemcpyHostToDevice ) );
+    gpuErrchk ( cudaMalloc ( &(gmDataHTo_d->fConvLPMData), sizeof( G4double ) * numLPMDat ) );
+    gpuErrchk ( cudaMemcpy (   gmDataHTo_d->fConvLPMData,  onHOST->fConvLPMData, sizeof( G4double ) * numLPMDat, cudaMemcpyHostToDevice ) );
+  } else {
+    gmDataHTo_d->fConvLPMStartIndexPerZ = nullptr;
+    gmDataHTo_d->fConvLPMData = nullptr;
+  }
+  //
+  // -- go for the Klein-Nishina inverse CDF tables for Compton (if any)
+  if (onHOST->fCompInvCDFData != nullptr) {
+    int numCompInvCDFDat = onHOST->fCompEnergyGridSize*onHOST->fCompInvCDFNumPoints;
+    gpuErrchk ( cudaMalloc ( &(gmDataHTo_d->fCompInvCDFData), sizeof( G4double ) * numCompInvCDFDat ) );
+    gpuErrchk ( cudaMemcpy (   gmDataHTo_d->fCompInvCDFData,  onHOST->fCompInvCDFData, sizeof( G4double ) * numCompInvCDFDat, cudaMemcpyHostToDevice ) );
+  }
+  //
+  // -- go for the single precision copies of the tables (if any)
+  if (onHOST->fConvCompMacXsecDataF32 != nullptr) {
+    gpuErrchk ( cudaMalloc ( &(gmDataHTo_d->fConvCompMacXsecDataF32), sizeof( float ) * numConvCompData ) );
+    gpuErrchk ( cudaMemcpy (   gmDataHTo_d->fConvCompMacXsecDataF32,  onHOST->fConvCompMacXsecDataF32, sizeof( float ) * numConvCompData, cudaMemcpyHostToDevice ) );
+  }
+  if (onHOST->fElemSelectorConvDataF32 != nullptr && numElSelDat > 0) {
+    gpuErrchk ( cudaMalloc ( &(gmDataHTo_d->fElemSelectorConvDataF32), sizeof( float ) * numElSelDat ) );
+    gpuErrchk ( cudaMemcpy (   gmDataHTo_d->fElemSelectorConvDataF32,  onHOST->fElemSelectorConvDataF32, sizeof( float ) * numElSelDat, cudaMemcpyHostToDevice ) );
+  }
+  //
   // Finaly copy the top level, i.e. the main struct with the already
   // appropriate pointers to device side memory locations but stored on the host
   gpuErrchk ( cudaMalloc (  onDEVICE,              sizeof(  struct G4HepEmGammaData ) ) );
@@ -100,6 +169,21 @@ void FreeGammaDataOnDevice(struct G4HepEmGammaData** onDEVICE) {
     cudaFree( onHostTo_d->fElemSelectorConvStartIndexPerMat );
     cudaFree( onHostTo_d->fElemSelectorConvEgrid );
     cudaFree( onHostTo_d->fElemSelectorConvData );
+    // photoelectric related data
+    cudaFree( onHostTo_d->fPEStartIndexPerMat );
+    cudaFree( onHostTo_d->fPEBinKnotIndex );
+    cudaFree( onHostTo_d->fPEData );
+    // fused macroscopic cross section data
+    cudaFree( onHostTo_d->fFusedEnergyGrid );
+    cudaFree( onHostTo_d->fFusedMacXsecData );
+    // conversion LPM function tables
+    cudaFree( onHostTo_d->fConvLPMStartIndexPerZ );
+    cudaFree( onHostTo_d->fConvLPMData );
+    // Klein-Nishina inverse CDF tables for Compton
+    cudaFree( onHostTo_d->fCompInvCDFData );
+    // single precision copies of the tables
+    cudaFree( onHostTo_d->fConvCompMacXsecDataF32 );
+    cudaFree( onHostTo_d->fElemSelectorConvDataF32 );
     //
     // free the remaining device side gamma data and set the host side ptr to null
     cudaFree( *onDEVICE );
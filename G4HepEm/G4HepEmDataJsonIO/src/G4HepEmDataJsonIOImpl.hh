@@ -157,6 +157,16 @@ namespace nlohmann
         j["fElectronBremModelLim"] = GET_VALUE(d->fElectronBremModelLim);
         j["fMSCRangeFactor"]       = GET_VALUE(d->fMSCRangeFactor);
         j["fMSCSafetyFactor"]      = GET_VALUE(d->fMSCSafetyFactor);
+        j["fGammaXSecTableLayout"] = d->fGammaXSecTableLayout;
+        j["fNumGammaFusedTableBinsPerDecade"] =
+          d->fNumGammaFusedTableBinsPerDecade;
+        j["fUseLPMFunctionTables"] = d->fUseLPMFunctionTables;
+        j["fUseFloat32Tables"]     = d->fUseFloat32Tables;
+        j["fUseUMSCAngularTables"] = d->fUseUMSCAngularTables;
+        j["fUseUMSCCorrectionTables"] = d->fUseUMSCCorrectionTables;
+        j["fUseRBBremEnvelopeTables"] = d->fUseRBBremEnvelopeTables;
+        j["fUseIoniInvCDFTables"]  = d->fUseIoniInvCDFTables;
+        j["fUseCompInvCDFTables"]  = d->fUseCompInvCDFTables;
       }
     }
 
@@ -180,6 +190,16 @@ namespace nlohmann
         d->fElectronBremModelLim = j.at("fElectronBremModelLim").get<double>();
         d->fMSCRangeFactor       = j.at("fMSCRangeFactor").get<double>();
         d->fMSCSafetyFactor      = j.at("fMSCSafetyFactor").get<double>();
+        d->fGammaXSecTableLayout = j.at("fGammaXSecTableLayout").get<int>();
+        d->fNumGammaFusedTableBinsPerDecade =
+          j.at("fNumGammaFusedTableBinsPerDecade").get<int>();
+        d->fUseLPMFunctionTables = j.at("fUseLPMFunctionTables").get<bool>();
+        d->fUseFloat32Tables     = j.at("fUseFloat32Tables").get<bool>();
+        d->fUseUMSCAngularTables = j.at("fUseUMSCAngularTables").get<bool>();
+        d->fUseUMSCCorrectionTables = j.at("fUseUMSCCorrectionTables").get<bool>();
+        d->fUseRBBremEnvelopeTables = j.at("fUseRBBremEnvelopeTables").get<bool>();
+        d->fUseIoniInvCDFTables  = j.at("fUseIoniInvCDFTables").get<bool>();
+        d->fUseCompInvCDFTables  = j.at("fUseCompInvCDFTables").get<bool>();
         return d;
       }
     }
@@ -216,6 +236,11 @@ namespace nlohmann
       j["fZFactor1"]     = GET_VALUE(d.fZFactor1);
       j["fDeltaMaxLow"]  = GET_VALUE(d.fDeltaMaxLow);
       j["fDeltaMaxHigh"] = GET_VALUE(d.fDeltaMaxHigh);
+      j["fDeltaFactorBH"] = GET_VALUE(d.fDeltaFactorBH);
+      ARR(d.fFZBH,tmp0,2);
+      j["fFZBH"]         = tmp0;
+      ARR(d.fInvDeltaMaxBH,tmp1,2);
+      j["fInvDeltaMaxBH"] = tmp1;
       j["fILVarS1"]      = GET_VALUE(d.fILVarS1);
       j["fILVarS1Cond"]  = GET_VALUE(d.fILVarS1Cond);
       j["fSandiaEnergies"] =
@@ -237,6 +262,13 @@ namespace nlohmann
       d.fZFactor1 = j.at("fZFactor1").get<double>();
       d.fDeltaMaxLow = j.at("fDeltaMaxLow").get<double>();
       d.fDeltaMaxHigh = j.at("fDeltaMaxHigh").get<double>();
+      d.fDeltaFactorBH = j.at("fDeltaFactorBH").get<double>();
+      BRR(d.fFZBH,tmp0,2);
+      BRR(d.fInvDeltaMaxBH,tmp1,2);
+      j.at("fFZBH").get_to(tmp0);
+      j.at("fInvDeltaMaxBH").get_to(tmp1);
+      CRR(d.fFZBH,tmp0,2);
+      CRR(d.fInvDeltaMaxBH,tmp1,2);
       d.fILVarS1 = j.at("fILVarS1").get<double>();
       d.fILVarS1Cond = j.at("fILVarS1Cond").get<double>();
 
@@ -551,6 +583,46 @@ namespace nlohmann
         j["fTr1MacXSecData"] =
           make_span(nTr1MacXsec, d->fTr1MacXSecData);
 
+        // optional Urban msc data (the theta0 correction is for e+ only)
+        j["fUMSCTlimitMinData"] = make_span(
+          d->fUMSCTlimitMinData != nullptr ? nTr1MacXsec : 0, d->fUMSCTlimitMinData);
+        j["fUMSCTheta0CorrData"] = make_span(
+          d->fUMSCTheta0CorrData != nullptr ? nTr1MacXsec : 0, d->fUMSCTheta0CorrData);
+
+        // optional Urban msc angular distribution tables
+        j["fUMSCAngularNumEkin"]    = d->fUMSCAngularNumEkin;
+        j["fUMSCAngularLogMinEkin"] = GET_VALUE(d->fUMSCAngularLogMinEkin);
+        j["fUMSCAngularEILDelta"]   = GET_VALUE(d->fUMSCAngularEILDelta);
+        j["fUMSCAngularNumTau"]     = d->fUMSCAngularNumTau;
+        j["fUMSCAngularLogMinTau"]  = GET_VALUE(d->fUMSCAngularLogMinTau);
+        j["fUMSCAngularTauILDelta"] = GET_VALUE(d->fUMSCAngularTauILDelta);
+        j["fUMSCAngularNumPoints"]  = d->fUMSCAngularNumPoints;
+        const int nUMSCAngular = d->fUMSCAngularData != nullptr
+          ? d->fNumMaterials * d->fUMSCAngularNumEkin * d->fUMSCAngularNumTau * d->fUMSCAngularNumPoints
+          : 0;
+        j["fUMSCAngularData"] = make_span(nUMSCAngular, d->fUMSCAngularData);
+
+        // optional relativistic brem rejection envelopes
+        j["fBremRBEnvNumEkin"]    = d->fBremRBEnvNumEkin;
+        j["fBremRBEnvLogMinEkin"] = GET_VALUE(d->fBremRBEnvLogMinEkin);
+        j["fBremRBEnvEILDelta"]   = GET_VALUE(d->fBremRBEnvEILDelta);
+        j["fBremRBEnvNumBins"]    = d->fBremRBEnvNumBins;
+        j["fBremRBEnvNumData"]    = d->fBremRBEnvNumData;
+        j["fBremRBEnvStartIndexPerMatCut"] = make_span(
+          d->fBremRBEnvStartIndexPerMatCut != nullptr ? d->fNumMatCuts : 0,
+          d->fBremRBEnvStartIndexPerMatCut);
+        j["fBremRBEnvData"] = make_span(
+          d->fBremRBEnvData != nullptr ? d->fBremRBEnvNumData : 0, d->fBremRBEnvData);
+
+        // optional Moller/Bhabha energy transfer inverse CDF tables
+        j["fIoniInvCDFNumPoints"] = d->fIoniInvCDFNumPoints;
+        j["fIoniInvCDFNumData"]   = d->fIoniInvCDFNumData;
+        j["fIoniInvCDFStartIndexPerMatCut"] = make_span(
+          d->fIoniInvCDFStartIndexPerMatCut != nullptr ? d->fNumMatCuts : 0,
+          d->fIoniInvCDFStartIndexPerMatCut);
+        j["fIoniInvCDFData"] = make_span(
+          d->fIoniInvCDFData != nullptr ? d->fIoniInvCDFNumData : 0, d->fIoniInvCDFData);
+
         j["fElemSelectorIoniStartIndexPerMatCut"] =
           make_span(d->fNumMatCuts, d->fElemSelectorIoniStartIndexPerMatCut);
         j["fElemSelectorIoniData"] =
@@ -565,6 +637,20 @@ namespace nlohmann
           make_span(d->fNumMatCuts, d->fElemSelectorBremRBStartIndexPerMatCut);
         j["fElemSelectorBremRBData"] =
           make_span(d->fElemSelectorBremRBNumData, d->fElemSelectorBremRBData);
+
+        // optional single precision copies of the tables
+        const bool hasF32Data = d->fELossDataF32 != nullptr;
+        j["fELossDataF32"] = make_span(hasF32Data ? nELoss : 0, d->fELossDataF32);
+        j["fResMacXSecDataF32"] = make_span(
+          hasF32Data ? d->fResMacXSecNumData : 0, d->fResMacXSecDataF32);
+        j["fTr1MacXSecDataF32"] =
+          make_span(hasF32Data ? nTr1MacXsec : 0, d->fTr1MacXSecDataF32);
+        j["fElemSelectorBremSBDataF32"] = make_span(
+          d->fElemSelectorBremSBDataF32 != nullptr ? d->fElemSelectorBremSBNumData : 0,
+          d->fElemSelectorBremSBDataF32);
+        j["fElemSelectorBremRBDataF32"] = make_span(
+          d->fElemSelectorBremRBDataF32 != nullptr ? d->fElemSelectorBremRBNumData : 0,
+          d->fElemSelectorBremRBDataF32);
       }
     }
 
@@ -607,6 +693,46 @@ namespace nlohmann
           d->fTr1MacXSecData    = tmpTr1Data.data;
         }
 
+        {
+          d->fUMSCTlimitMinData =
+            j.at("fUMSCTlimitMinData").get<dynamic_array<G4double>>().data;
+          d->fUMSCTheta0CorrData =
+            j.at("fUMSCTheta0CorrData").get<dynamic_array<G4double>>().data;
+        }
+
+        {
+          j.at("fUMSCAngularNumEkin").get_to(d->fUMSCAngularNumEkin);
+          d->fUMSCAngularLogMinEkin = j.at("fUMSCAngularLogMinEkin").get<double>();
+          d->fUMSCAngularEILDelta   = j.at("fUMSCAngularEILDelta").get<double>();
+          j.at("fUMSCAngularNumTau").get_to(d->fUMSCAngularNumTau);
+          d->fUMSCAngularLogMinTau  = j.at("fUMSCAngularLogMinTau").get<double>();
+          d->fUMSCAngularTauILDelta = j.at("fUMSCAngularTauILDelta").get<double>();
+          j.at("fUMSCAngularNumPoints").get_to(d->fUMSCAngularNumPoints);
+          d->fUMSCAngularData =
+            j.at("fUMSCAngularData").get<dynamic_array<G4double>>().data;
+        }
+
+        {
+          j.at("fBremRBEnvNumEkin").get_to(d->fBremRBEnvNumEkin);
+          d->fBremRBEnvLogMinEkin = j.at("fBremRBEnvLogMinEkin").get<double>();
+          d->fBremRBEnvEILDelta   = j.at("fBremRBEnvEILDelta").get<double>();
+          j.at("fBremRBEnvNumBins").get_to(d->fBremRBEnvNumBins);
+          j.at("fBremRBEnvNumData").get_to(d->fBremRBEnvNumData);
+          d->fBremRBEnvStartIndexPerMatCut =
+            j.at("fBremRBEnvStartIndexPerMatCut").get<dynamic_array<int>>().data;
+          d->fBremRBEnvData =
+            j.at("fBremRBEnvData").get<dynamic_array<G4double>>().data;
+        }
+
+        {
+          j.at("fIoniInvCDFNumPoints").get_to(d->fIoniInvCDFNumPoints);
+          j.at("fIoniInvCDFNumData").get_to(d->fIoniInvCDFNumData);
+          d->fIoniInvCDFStartIndexPerMatCut =
+            j.at("fIoniInvCDFStartIndexPerMatCut").get<dynamic_array<int>>().data;
+          d->fIoniInvCDFData =
+            j.at("fIoniInvCDFData").get<dynamic_array<G4double>>().data;
+        }
+
         {
           auto tmpIndex = j.at("fElemSelectorIoniStartIndexPerMatCut")
                             .get<dynamic_array<int>>();
@@ -643,6 +769,19 @@ namespace nlohmann
           d->fElemSelectorBremRBData    = tmpData.data;
         }
 
+        {
+          d->fELossDataF32 =
+            j.at("fELossDataF32").get<dynamic_array<float>>().data;
+          d->fResMacXSecDataF32 =
+            j.at("fResMacXSecDataF32").get<dynamic_array<float>>().data;
+          d->fTr1MacXSecDataF32 =
+            j.at("fTr1MacXSecDataF32").get<dynamic_array<float>>().data;
+          d->fElemSelectorBremSBDataF32 =
+            j.at("fElemSelectorBremSBDataF32").get<dynamic_array<float>>().data;
+          d->fElemSelectorBremRBDataF32 =
+            j.at("fElemSelectorBremRBDataF32").get<dynamic_array<float>>().data;
+        }
+
         return d;
       }
     }
@@ -788,6 +927,51 @@ namespace nlohmann
 
         j["fElemSelectorConvData"] =
           make_span(d->fElemSelectorConvNumData, d->fElemSelectorConvData);
+
+        //// === photoelectric related data. Lookup grid: 208 bins (16 per
+        /// decades) from 10 eV - 100 TeV
+        const bool hasPEData = d->fPENumData > 0;
+        j["fPELogMinEkin"] = GET_VALUE(d->fPELogMinEkin);
+        j["fPEEILDelta"]   = GET_VALUE(d->fPEEILDelta);
+        j["fPEStartIndexPerMat"] =
+          make_span(hasPEData ? d->fNumMaterials : 0, d->fPEStartIndexPerMat);
+        j["fPEBinKnotIndex"] = make_span(
+          hasPEData ? d->fNumMaterials * (d->fPEEnergyGridSize - 1) : 0,
+          d->fPEBinKnotIndex);
+        j["fPEData"] = make_span(d->fPENumData, d->fPEData);
+
+        //// === fused macroscopic cross section table (optional)
+        j["fFusedLogMinEkin"] = GET_VALUE(d->fFusedLogMinEkin);
+        j["fFusedEILDelta"]   = GET_VALUE(d->fFusedEILDelta);
+        j["fFusedEnergyGrid"] =
+          make_span(d->fFusedEnergyGridSize, d->fFusedEnergyGrid);
+        j["fFusedMacXsecData"] =
+          make_span(d->fNumMaterials * d->fFusedEnergyGridSize * 4,
+                    d->fFusedMacXsecData);
+
+        //// === LPM function tables for conversion (optional)
+        const bool hasLPMData = d->fConvLPMNumData > 0;
+        j["fConvLPMLogMinVar"] = GET_VALUE(d->fConvLPMLogMinVar);
+        j["fConvLPMILDelta"]   = GET_VALUE(d->fConvLPMILDelta);
+        j["fConvLPMStartIndexPerZ"] = make_span(
+          hasLPMData ? d->fConvLPMMaxZet + 1 : 0, d->fConvLPMStartIndexPerZ);
+        j["fConvLPMData"] = make_span(d->fConvLPMNumData, d->fConvLPMData);
+
+        //// === Klein-Nishina inverse CDF tables for Compton (optional)
+        j["fCompInvCDFNumPoints"] = d->fCompInvCDFNumPoints;
+        j["fCompInvCDFData"]      = make_span(
+          d->fCompInvCDFData != nullptr
+            ? d->fCompEnergyGridSize * d->fCompInvCDFNumPoints
+            : 0,
+          d->fCompInvCDFData);
+
+        //// === single precision copies of the tables (optional)
+        j["fConvCompMacXsecDataF32"] = make_span(
+          d->fConvCompMacXsecDataF32 != nullptr ? macXsecDataSize : 0,
+          d->fConvCompMacXsecDataF32);
+        j["fElemSelectorConvDataF32"] = make_span(
+          d->fElemSelectorConvDataF32 != nullptr ? d->fElemSelectorConvNumData : 0,
+          d->fElemSelectorConvDataF32);
       }
     }
 
@@ -847,6 +1031,55 @@ namespace nlohmann
         d->fElemSelectorConvNumData = tmpConvData.N;
         d->fElemSelectorConvData    = tmpConvData.data;
 
+        d->fPELogMinEkin = j.at("fPELogMinEkin").get<double>();
+        d->fPEEILDelta   = j.at("fPEEILDelta").get<double>();
+        // sizes of the following two arrays are d->fNumMaterials and
+        // d->fNumMaterials*(d->fPEEnergyGridSize-1)
+        auto tmpPEStartIndexPerMat =
+          j.at("fPEStartIndexPerMat").get<dynamic_array<int>>();
+        d->fPEStartIndexPerMat = tmpPEStartIndexPerMat.data;
+
+        auto tmpPEBinKnotIndex =
+          j.at("fPEBinKnotIndex").get<dynamic_array<int>>();
+        d->fPEBinKnotIndex = tmpPEBinKnotIndex.data;
+
+        auto tmpPEData = j.at("fPEData").get<dynamic_array<G4double>>();
+        d->fPENumData  = tmpPEData.N;
+        d->fPEData     = tmpPEData.data;
+
+        d->fFusedLogMinEkin = j.at("fFusedLogMinEkin").get<double>();
+        d->fFusedEILDelta   = j.at("fFusedEILDelta").get<double>();
+        auto tmpFusedEnergyGrid =
+          j.at("fFusedEnergyGrid").get<dynamic_array<G4double>>();
+        d->fFusedEnergyGridSize = tmpFusedEnergyGrid.N;
+        d->fFusedEnergyGrid     = tmpFusedEnergyGrid.data;
+        // size is d->fNumMaterials * d->fFusedEnergyGridSize * 4
+        auto tmpFusedMacXsecData =
+          j.at("fFusedMacXsecData").get<dynamic_array<G4double>>();
+        d->fFusedMacXsecData = tmpFusedMacXsecData.data;
+
+        d->fConvLPMLogMinVar = j.at("fConvLPMLogMinVar").get<double>();
+        d->fConvLPMILDelta   = j.at("fConvLPMILDelta").get<double>();
+        auto tmpConvLPMStartIndexPerZ =
+          j.at("fConvLPMStartIndexPerZ").get<dynamic_array<int>>();
+        d->fConvLPMMaxZet = tmpConvLPMStartIndexPerZ.N > 0
+                              ? tmpConvLPMStartIndexPerZ.N - 1
+                              : 0;
+        d->fConvLPMStartIndexPerZ = tmpConvLPMStartIndexPerZ.data;
+        auto tmpConvLPMData =
+          j.at("fConvLPMData").get<dynamic_array<G4double>>();
+        d->fConvLPMNumData = tmpConvLPMData.N;
+        d->fConvLPMData    = tmpConvLPMData.data;
+
+        d->fCompInvCDFNumPoints = j.at("fCompInvCDFNumPoints").get<int>();
+        d->fCompInvCDFData =
+          j.at("fCompInvCDFData").get<dynamic_array<G4double>>().data;
+
+        d->fConvCompMacXsecDataF32 =
+          j.at("fConvCompMacXsecDataF32").get<dynamic_array<float>>().data;
+        d->fElemSelectorConvDataF32 =
+          j.at("fElemSelectorConvDataF32").get<dynamic_array<float>>().data;
+
         return d;
       }
     }
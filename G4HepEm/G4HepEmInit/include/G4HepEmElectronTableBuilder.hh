@@ -6,6 +6,9 @@
 // computes the dedx for e-/e+ and builds the range, dedx and inverse range tables
 // for all material-cuts couples
 
+#include <cstddef>
+#include <unordered_map>
+
 class G4VEmModel;
 class G4MollerBhabhaModel;
 class G4SeltzerBergerModel;
@@ -31,11 +34,42 @@ void BuildLambdaTables(G4MollerBhabhaModel* mbModel, G4SeltzerBergerModel* sbMod
 void BuildTransportXSectionTables(G4VEmModel* mscModel, struct G4HepEmData* hepEmData,
                       struct G4HepEmParameters* hepEmParams, bool iselectron);
 
+// builds the per material Urban msc minimum step limit factor and e+ theta0
+// correction tables over the energy loss energy grid
+void BuildUMSCTables(struct G4HepEmData* hepEmData, struct G4HepEmParameters* hepEmParams,
+                      bool iselectron);
+
+// builds the per material Urban msc angular distribution (scaled inverse CDF)
+// tables over a kinetic energy and tau (step length in first transport mfp) grid
+void BuildUMSCAngularTables(struct G4HepEmData* hepEmData, struct G4HepEmParameters* hepEmParams,
+                      bool iselectron);
+
+void BuildUMSCAngularTable(G4double ekin, G4double tau, G4double lambdaTr1, const struct G4HepEmMatData& matData,
+                      G4double theta0Corr, int numPoints, G4double* data);
+
+// builds the piecewise constant rejection envelopes of the relativistic brem
+// energy transfer sampling for all material-cuts couples and their elements
+void BuildBremRBEnvelopeTables(struct G4HepEmData* hepEmData, struct G4HepEmParameters* hepEmParams,
+                      bool iselectron);
+
+// builds the inverse CDF tables of the Moller (e-) or Bhabha (e+) energy transfer
+// for all secondary e- production cuts over a kinetic energy grid
+void BuildIoniInvCDFTables(struct G4HepEmData* hepEmData, struct G4HepEmParameters* hepEmParams,
+                      bool iselectron);
+
+void BuildIoniInvCDFTable(G4double ekin, G4double elCut, bool iselectron, int numPoints, G4double* data);
+
 void BuildElementSelectorTables(G4MollerBhabhaModel* mbModel, G4SeltzerBergerModel* sbModel,
                       G4eBremsstrahlungRelModel* rbModel, struct G4HepEmData* hepEmData,
                       struct G4HepEmParameters* hepEmParams, bool iselectron);
 
 
+// shares the element selector data, that have just been built from `startIndex`
+// till `indxCont`, with an earlier identical one (if any): `startIndex` is set
+// to that and `indxCont` is rewound
+void ShareIdenticalSelector(const G4double* data, int& indxCont, int& startIndex,
+                            std::unordered_multimap<std::size_t, int>& registry);
+
 void BuildElementSelector(G4double minEKin, G4double maxEKin, int numBinsPerDecade, G4double *data, int& indxCont, const struct G4HepEmMatData& matData, G4VEmModel* emModel, G4double cut, const G4ParticleDefinition* g4PartDef);
 
 int InitElementSelectorEnergyGrid(int binsperdecade, G4double* egrid, G4double mine, G4double maxe,
@@ -43,4 +77,9 @@ int InitElementSelectorEnergyGrid(int binsperdecade, G4double* egrid, G4double m
 
 void BuildSBBremSTables(struct G4HepEmData* hepEmData, struct G4HepEmParameters* hepEmPars, G4SeltzerBergerModel* sbModel);
 
+// builds the (optional) single precision copies of the e-loss, macroscopic cross
+// section and brem target element selector tables (must be invoked after all
+// the double precision tables have been built)
+void BuildFloat32Tables(struct G4HepEmData* hepEmData, bool iselectron);
+
 #endif  // G4HepEmElectronTableBuilder_HH
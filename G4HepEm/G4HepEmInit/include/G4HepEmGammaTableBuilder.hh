@@ -21,4 +21,24 @@ void BuildLambdaTables(G4PairProductionRelModel* ppModel, G4KleinNishinaCompton*
 
 void BuildElementSelectorTables(G4PairProductionRelModel* ppModel, struct G4HepEmData* hepEmData);
 
+// builds the photoelectric knot tables (Sandia coefficients and element selectors)
+// for all materials with the O(1) lookup from the log-energy grid
+void BuildPhotoElectricTables(struct G4HepEmData* hepEmData);
+
+// builds the (optional) fused conversion, Compton, photoelectric and total
+// macroscopic cross section table for all materials
+void BuildFusedMacXSecTable(G4PairProductionRelModel* ppModel, G4KleinNishinaCompton* knModel,
+                            struct G4HepEmData* hepEmData, struct G4HepEmParameters* hepEmPars);
+
+// builds the LPM function tables used in conversion for all elements
+void BuildConvLPMFunctionTables(struct G4HepEmData* hepEmData);
+
+// builds the (optional) Klein-Nishina inverse CDF tables of the reduced photon
+// energy used in Compton scattering over the Compton energy grid
+void BuildCompInvCDFTables(struct G4HepEmData* hepEmData);
+
+// builds the (optional) single precision copies of the conversion and Compton
+// macroscopic cross section and the conversion element selector tables
+void BuildFloat32Tables(struct G4HepEmData* hepEmData);
+
 #endif // G4HepEmGammaTableBuilder_HH
@@ -3,6 +3,9 @@
 #ifndef G4HepEmInitUtils_HH
 #define G4HepEmInitUtils_HH
 
+#include <cstddef>
+#include <unordered_map>
+
 //
 // Utility methods used during the initialisation.
 //
@@ -62,6 +65,23 @@ public:
   // that x[i] <= x < x[i+1]
   static int    FindLowerBinIndex(G4double* xdata, int num, G4double x, int step=1);
 
+  // allocates and returns a single precision copy of the first `num` values of
+  // `data` (nullptr if `data` is null or `num` is not positive)
+  static float* MakeFloatCopy(int num, const G4double* data);
+
+  // hash of the values of the `num` data (used to find identical tables)
+  static std::size_t HashData(const G4double* data, int num);
+
+  // Table deduplication: the `num` values, that have just been written into
+  // `data` from the `start` index, are compared to all the earlier tables
+  // registered in `registry` (hash -> start index). Returns the start index of
+  // an identical earlier table if any (the caller can then reuse that and
+  // rewind its continuous index to `start`), otherwise registers this table
+  // and returns `start`. (No deduplication in AD builds: tables with the same
+  // values might have different derivatives.)
+  static int    ShareIdenticalData(const G4double* data, int start, int num,
+                                   std::unordered_multimap<std::size_t, int>& registry);
+
    /**
    * Fills a pre-existing array with G4doubles uniformly spaced in log(x)
    *
@@ -107,9 +107,39 @@ void InitElectronData(struct G4HepEmData* hepEmData, struct G4HepEmParameters* h
   // build macroscopic first transport cross section data (used by Urban msc)
   std::cout << "     ---  BuildTransportXSectionTables ... " << std::endl;
   BuildTransportXSectionTables(modelUMSC, hepEmData, hepEmPars, iselectron);
+  // build the Urban msc step limit and theta0 correction data if required
+  if (hepEmPars->fUseUMSCCorrectionTables) {
+    std::cout << "     ---  BuildUMSCTables ... " << std::endl;
+    BuildUMSCTables(hepEmData, hepEmPars, iselectron);
+  }
+  // build the Urban msc angular distribution tables if required
+  if (hepEmPars->fUseUMSCAngularTables) {
+    std::cout << "     ---  BuildUMSCAngularTables ... " << std::endl;
+    BuildUMSCAngularTables(hepEmData, hepEmPars, iselectron);
+  }
+  // build the relativistic brem rejection envelopes if required
+  if (hepEmPars->fUseRBBremEnvelopeTables) {
+    std::cout << "     ---  BuildBremRBEnvelopeTables ... " << std::endl;
+    BuildBremRBEnvelopeTables(hepEmData, hepEmPars, iselectron);
+  }
+  // build the Moller/Bhabha energy transfer inverse CDF tables if required
+  if (hepEmPars->fUseIoniInvCDFTables) {
+    std::cout << "     ---  BuildIoniInvCDFTables ... " << std::endl;
+    BuildIoniInvCDFTables(hepEmData, hepEmPars, iselectron);
+  }
   // build element selectors
   std::cout << "     ---  BuildElementSelectorTables ... " << std::endl;
   BuildElementSelectorTables(modelMB, modelSB, modelRB, hepEmData, hepEmPars, iselectron);
+  // build the single precision copies of the tables if required
+  if (hepEmPars->fUseFloat32Tables) {
+#if defined(CODI_FORWARD) || defined(CODI_REVERSE)
+    std::cerr << " *** G4HepEm InitElectronData: single precision tables are not supported"
+              << " in the AD build (the double precision tables are used)." << std::endl;
+#else
+    std::cout << "     ---  BuildFloat32Tables ... " << std::endl;
+    BuildFloat32Tables(hepEmData, iselectron);
+#endif
+  }
   //
   // === Initialize the interaction description part of all models
   //
@@ -15,6 +15,12 @@
 #include "G4HepEmSBBremTableBuilder.hh"
 #include "G4HepEmSBTableData.hh"
 
+#include "G4HepEmElectronInteractionUMSC.hh"
+#include "G4HepEmElectronInteractionBrem.hh"
+#include "G4HepEmElectronInteractionIoni.hh"
+#include "G4HepEmElectronManager.hh"
+#include "G4HepEmConstants.hh"
+
 
 // g4 includes
 #include "G4Version.hh"
@@ -34,6 +40,8 @@
 
 
 #include <cmath>
+#include <vector>
+#include <functional>
 
 
 void BuildELossTables(G4MollerBhabhaModel* mbModel, G4SeltzerBergerModel* sbModel,
@@ -234,6 +242,8 @@ void BuildLambdaTables(G4MollerBhabhaModel* mbModel, G4SeltzerBergerModel* sbMod
   elData->fResMacXSecStartIndexPerMatCut = new int[numHepEmMCCData]{};
   // a continuous index
   int indxCont = 0;
+  // the tables already stored (to share the identical ones among mat-cuts)
+  std::unordered_multimap<std::size_t, int> tableRegistry;
   for (int imc=0; imc<numHepEmMCCData; ++imc) {
     // ====== Common data
     const struct G4HepEmMCCData& mccData = hepEmMCData->fMatCutData[imc];
@@ -336,6 +346,15 @@ void BuildLambdaTables(G4MollerBhabhaModel* mbModel, G4SeltzerBergerModel* sbMod
       xsecData[indxCont++] = macXSec[ie];
       xsecData[indxCont++] = secDerivs[ie];
     }
+    //
+    // ===== Share the (ioni + brem) data with an earlier mat-cut if identical
+    //
+    const int iStart  = elData->fResMacXSecStartIndexPerMatCut[imc];
+    const int iShared = G4HepEmInitUtils::ShareIdenticalData(xsecData, iStart, indxCont-iStart, tableRegistry);
+    if (iShared != iStart) {
+      elData->fResMacXSecStartIndexPerMatCut[imc] = iShared;
+      indxCont = iStart;
+    }
   }
   // allocate data, in the fTheElectronData member of the top level data structure,
   // for all the macroscopic-scross section data for all mat-cuts and store them
@@ -427,6 +446,449 @@ void BuildTransportXSectionTables(G4VEmModel* mscModel, struct G4HepEmData* hepE
 }
 
 
+void BuildUMSCTables(struct G4HepEmData* hepEmData, struct G4HepEmParameters* /*hepEmParams*/,
+                     bool iselectron) {
+  // get the pointer to the already allocated G4HepEmElectronData from the HepEmData
+  struct G4HepEmElectronData* elData = iselectron
+                                       ? hepEmData->fTheElectronData
+                                       : hepEmData->fThePositronData;
+  //
+  // NOTE: the energy grid is the same taht is used for the e-loss data and it
+  //       has already been generated at this point (BuildELossTables should have
+  //       been called before)
+  const int numEner       = elData->fELossEnergyGridSize;
+  const int numMaterials  = elData->fNumMaterials;
+  //
+  // allocate some array for intermediate storage of the values and their second
+  // derivatives for a given material
+  G4double* theValues     = new G4double[numEner]{};
+  G4double* theValuesSD   = new G4double[numEner]{};
+  // allocate the arrays to store (continuously) the data for all materials: the
+  // theta0 correction is needed only for e+
+  delete[] elData->fUMSCTlimitMinData;
+  delete[] elData->fUMSCTheta0CorrData;
+  elData->fUMSCTlimitMinData  = new G4double[2*numEner*numMaterials]{};
+  elData->fUMSCTheta0CorrData = iselectron ? nullptr : new G4double[2*numEner*numMaterials]{};
+  //
+  // loop over the HepEm materials and for each compute the step limit factor
+  // and the e+ theta0 correction at each of the discrete kinetic energies using
+  // the same functions that are used at run-time when these tables are not available
+  // note: the inverse of the step limit factor is tabulated, that is a quadratic
+  //       function of the energy above 5 keV so its spline is (almost) exact
+  const struct G4HepEmMaterialData*  hepEmMatData = hepEmData->fTheMaterialData;
+  for (int im=0; im<numMaterials; ++im) {
+    const struct G4HepEmMatData& matData = hepEmMatData->fMaterialData[im];
+    const int iStart = 2*numEner*im;
+    for (int ie=0; ie<numEner; ++ie) {
+      theValues[ie]   = 1.0/G4HepEmElectronInteractionUMSC::ComputeTlimitMinFactor(elData->fELossEnergyGrid[ie],
+                          matData.fZeff23, matData.fZeffSqrt, matData.fUMSCStepMinPars, iselectron);
+      theValuesSD[ie] = 0.0;
+    }
+    G4HepEmInitUtils::PrepareSpline(numEner, elData->fELossEnergyGrid, theValues, theValuesSD);
+    for (int ie=0; ie<numEner; ++ie) {
+      elData->fUMSCTlimitMinData[iStart+2*ie]   = theValues[ie];
+      elData->fUMSCTlimitMinData[iStart+2*ie+1] = theValuesSD[ie];
+    }
+    if (iselectron) {
+      continue;
+    }
+    // the correction depends on the product of the pre- and post-step point
+    // kinetic energies: tabulated as a function of their geometric mean
+    for (int ie=0; ie<numEner; ++ie) {
+      const G4double ekin = elData->fELossEnergyGrid[ie];
+      theValues[ie]   = G4HepEmElectronInteractionUMSC::Theta0PositronCorrection(ekin*ekin, matData.fZeff);
+      theValuesSD[ie] = 0.0;
+    }
+    G4HepEmInitUtils::PrepareSpline(numEner, elData->fELossEnergyGrid, theValues, theValuesSD);
+    for (int ie=0; ie<numEner; ++ie) {
+      elData->fUMSCTheta0CorrData[iStart+2*ie]   = theValues[ie];
+      elData->fUMSCTheta0CorrData[iStart+2*ie+1] = theValuesSD[ie];
+    }
+  }
+  // free auxilary arrays
+  delete[] theValues;
+  delete[] theValuesSD;
+}
+
+
+void BuildUMSCAngularTables(struct G4HepEmData* hepEmData, struct G4HepEmParameters* /*hepEmParams*/,
+                     bool iselectron) {
+  // get the pointer to the already allocated G4HepEmElectronData from the HepEmData
+  struct G4HepEmElectronData* elData = iselectron
+                                       ? hepEmData->fTheElectronData
+                                       : hepEmData->fThePositronData;
+  //
+  // NOTE: the first transport mfp tables have already been built at this point
+  //       (BuildTransportXSectionTables should have been called before)
+  //
+  // the kinetic energy grid: 2 points per decade over [1 keV, 100 TeV]; the tau
+  // grid: 8 points per decade over [1E-4, 8] (the analytic sampling is used
+  // outside); 64 quantiles per distribution
+  const int      numEkin   = 23;
+  const G4double minEkin   = 1.0E-3;
+  const G4double maxEkin   = 1.0E+8;
+  const int      numTau    = 40;
+  const G4double minTau    = 1.0E-4;
+  const G4double maxTau    = 8.0;
+  const int      numPoints = 64;
+  const int      numMaterials = elData->fNumMaterials;
+  elData->fUMSCAngularNumEkin     = numEkin;
+  elData->fUMSCAngularLogMinEkin  = std::log(minEkin);
+  elData->fUMSCAngularEILDelta    = (numEkin-1)/std::log(maxEkin/minEkin);
+  elData->fUMSCAngularNumTau      = numTau;
+  elData->fUMSCAngularLogMinTau   = std::log(minTau);
+  elData->fUMSCAngularTauILDelta  = (numTau-1)/std::log(maxTau/minTau);
+  elData->fUMSCAngularNumPoints   = numPoints;
+  delete[] elData->fUMSCAngularData;
+  elData->fUMSCAngularData = new G4double[numMaterials*numEkin*numTau*numPoints]{};
+  //
+  // loop over the HepEm materials and build the tables at each (ekin, tau) grid point
+  const struct G4HepEmMaterialData*  hepEmMatData = hepEmData->fTheMaterialData;
+  for (int im=0; im<numMaterials; ++im) {
+    const struct G4HepEmMatData& matData = hepEmMatData->fMaterialData[im];
+    for (int ie=0; ie<numEkin; ++ie) {
+      const G4double lekin = elData->fUMSCAngularLogMinEkin + ie/elData->fUMSCAngularEILDelta;
+      const G4double  ekin = std::exp(lekin);
+      const G4double lambdaTr1  = G4HepEmElectronManager::GetTransportMFP(elData, im, ekin, lekin);
+      const G4double theta0Corr = iselectron ? 1.0 : G4HepEmElectronInteractionUMSC::Theta0PositronCorrection(ekin*ekin, matData.fZeff);
+      for (int it=0; it<numTau; ++it) {
+        const G4double tau = std::exp(elData->fUMSCAngularLogMinTau + it/elData->fUMSCAngularTauILDelta);
+        G4double* data = &(elData->fUMSCAngularData[((im*numEkin + ie)*numTau + it)*numPoints]);
+        BuildUMSCAngularTable(ekin, tau, lambdaTr1, matData, theta0Corr, numPoints, data);
+      }
+    }
+  }
+}
+
+
+// builds the scaled (by `tau`) inverse CDF of mu = (1-cos(theta))/2 of the
+// Urban msc angular distribution at the quantiles u_k = 1-(1-k/(K-1))^4,
+// k=1,...,K-1 (K = `numPoints`) for a step of `tau` first transport mfp without
+// energy loss (i.e. the same as in SampleCosineTheta with pre- = post-step
+// kinetic energy and a step that is not extremely small). The first value
+// (mu = 0 at u_0 = 0 is implicit) is set to 1 if the simple (two model
+// functions) distribution is used at this point and 0 otherwise.
+void BuildUMSCAngularTable(G4double ekin, G4double tau, G4double lambdaTr1, const struct G4HepEmMatData& matData,
+                           G4double theta0Corr, int numPoints, G4double* data) {
+  // the mean and second moment of cos(theta) (without the tail)
+  G4double xmeanth, x2meanth;
+  if (tau < 0.01) {
+    xmeanth  = 1.0 - tau*(1.0 - 0.5*tau);
+    x2meanth = 1.0 - tau*(5.0 - 6.25*tau)*0.333333;
+  } else {
+    xmeanth  = std::exp(-tau);
+    x2meanth = (1.0 + 2.0*std::exp(-2.5*tau))*0.333333;
+  }
+  // the complementary CDF of cos(theta) at 1-2mu i.e. the CDF of mu, for the
+  // different cases of the model
+  std::function<G4double(G4double)> cdfMu;
+  bool isSimple = false;
+  // - the simple (two model functions) distribution
+  auto simpleCDF = [xmeanth, x2meanth](G4double mu) {
+    const G4double dum0 = 3.*x2meanth - 1;
+    const G4double dum1 = 2.*xmeanth  - dum0;
+    const G4double    a = 1. + 4.*dum0/dum1;
+    const G4double prob = std::max(0.0, std::min(1.0, (2. + a)*xmeanth/a));
+    const G4double   dum = 1. + a > 0. ? 1. - std::pow(1. - mu, 1. + a) : mu;
+    return prob*dum + (1. - prob)*mu;
+  };
+  const G4double pStepLength = tau*lambdaTr1;
+  const G4double theta0      = G4HepEmElectronInteractionUMSC::ComputeTheta0(pStepLength/matData.fRadiationLength, ekin, ekin, theta0Corr, matData.fUMSCThetaCoeff);
+  const G4double theta2      = theta0*theta0;
+  if (theta0 > kPi*0.166666) {
+    cdfMu    = simpleCDF;
+    isSimple = true;
+  } else if (theta2 < 1.0E-16) {
+    // no scattering
+    for (int k=0; k<numPoints; ++k) {
+      data[k] = 0.0;
+    }
+    return;
+  } else {
+    const G4double* tailCoeff = matData.fUMSCTailCoeff;
+    const G4double parU   = std::pow(tau, 0.1666666);
+    const G4double dumxsi = tailCoeff[0] + parU*(tailCoeff[1] + parU*tailCoeff[2])
+                          + tailCoeff[3]*std::log(lambdaTr1/matData.fRadiationLength);
+    const G4double parXsi = std::max(dumxsi, 1.9);
+    const G4double   parC =   std::abs(parXsi - 3.) < 0.001 ? 3.001
+                          : std::abs(parXsi - 2.) < 0.001 ? 2.001
+                          : parXsi;
+    const G4double dumC1  = parC - 1.;
+    const G4double dumEa  = std::exp(-parXsi);
+    const G4double dumEaa = 1./(1. - dumEa);
+    G4double thex = theta2*(1.0 - theta2*0.0833333);
+    if (theta2 > 0.01) {
+      const G4double  dum = 2.0*std::sin(0.5*theta0);
+      thex = dum*dum;
+    }
+    const G4double xmean1 = 1. - (1. - (1. + parXsi)*dumEa)*thex*dumEaa;
+    if (xmean1 <= 0.999*xmeanth) {
+      cdfMu    = simpleCDF;
+      isSimple = true;
+    } else {
+      const G4double  x0 = 1. - parXsi*thex;
+      const G4double  bx = parC*thex;
+      const G4double   b = bx + x0;
+      const G4double  b1 = b + 1.;
+      const G4double eb1 = std::pow(b1, dumC1);
+      const G4double ebx = std::pow(bx, dumC1);
+      const G4double   d = ebx/eb1;
+      const G4double xmean2 = (x0 + d - (bx - b1*d)/(parC - 2.))/(1. - d);
+      const G4double f1x0 = dumEa*dumEaa;
+      const G4double f2x0 = dumC1/(parC*(1. - d));
+      const G4double prob = f2x0/(f1x0 + f2x0);
+      const G4double qprb = std::max(0.0, std::min(1.0, xmeanth/(prob*xmean1 + (1. - prob)*xmean2)));
+      cdfMu = [=](G4double mu) {
+        // the exponential part on [x0, 1] and the tail on [-1, x0]
+        const G4double cdf1 = std::max(0.0, std::min(1.0, 1. - (std::exp(-2.*mu/thex) - dumEa)*dumEaa));
+        const G4double    w = (parC - parXsi + 2.*mu/thex)/parC;
+        const G4double    v = w > 1. ? std::pow(w, -dumC1) : 1.;
+        const G4double cdf2 = 1. - std::max(0.0, std::min(1.0, (v - d)/(1. - d)));
+        return qprb*(prob*cdf1 + (1. - prob)*cdf2) + (1. - qprb)*mu;
+      };
+    }
+  }
+  // invert the CDF at the quantiles by bisection on log(mu)
+  const G4double kLogMuMin = std::log(1.0E-12);
+  data[0] = isSimple ? 1.0 : 0.0;
+  for (int k=1; k<numPoints; ++k) {
+    const G4double dum = 1.0 - k/(numPoints-1.0);
+    const G4double   u = 1.0 - dum*dum*dum*dum;
+    G4double lmuLow  = kLogMuMin;
+    G4double lmuHigh = 0.0;
+    if (cdfMu(1.0) <= u) {
+      lmuLow = 0.0;
+    } else if (cdfMu(std::exp(lmuLow)) >= u) {
+      lmuHigh = lmuLow;
+    }
+    for (int iter=0; iter<40 && lmuHigh-lmuLow > 1.0E-9; ++iter) {
+      const G4double lmu = 0.5*(lmuLow + lmuHigh);
+      if (cdfMu(std::exp(lmu)) < u) {
+        lmuLow  = lmu;
+      } else {
+        lmuHigh = lmu;
+      }
+    }
+    data[k] = std::exp(0.5*(lmuLow + lmuHigh))/tau;
+  }
+}
+
+
+void BuildBremRBEnvelopeTables(struct G4HepEmData* hepEmData, struct G4HepEmParameters* hepEmParams,
+                     bool iselectron) {
+  // get the pointer to the already allocated G4HepEmElectronData from the HepEmData
+  struct G4HepEmElectronData* elData = iselectron
+                                       ? hepEmData->fTheElectronData
+                                       : hepEmData->fThePositronData;
+  //
+  // the kinetic energy grid: 8 points per decade over the energy range of the
+  // relativistic model; 16 envelope bins, each with the maximum of 17 equally
+  // spaced evaluations of the rejection function increased by 2 %
+  const int      numBins   = 16;
+  const int      numEvals  = 17;
+  const G4double margin    = 1.02;
+  const G4double minEkin   = hepEmParams->fElectronBremModelLim;
+  const G4double maxEkin   = hepEmParams->fMaxLossTableEnergy;
+  const int      numEkin   = std::max(2, (int)std::ceil(8.0*std::log10(GET_VALUE(maxEkin/minEkin)))+1);
+  elData->fBremRBEnvNumEkin    = numEkin;
+  elData->fBremRBEnvLogMinEkin = std::log(minEkin);
+  elData->fBremRBEnvEILDelta   = (numEkin-1)/std::log(maxEkin/minEkin);
+  elData->fBremRBEnvNumBins    = numBins;
+  //
+  // get the HepEm Material-cut couple data
+  const struct G4HepEmMatCutData*    hepEmMCData = hepEmData->fTheMatCutData;
+  const struct G4HepEmMaterialData* hepEmMatData = hepEmData->fTheMaterialData;
+  const struct G4HepEmElementData*   hepEmElData = hepEmData->fTheElementData;
+  const int numHepEmMCCData = hepEmMCData->fNumMatCutData;
+  // count the number of data: couples with the same material and gamma
+  // production cut share the envelopes
+  delete[] elData->fBremRBEnvStartIndexPerMatCut;
+  elData->fBremRBEnvStartIndexPerMatCut = new int[numHepEmMCCData];
+  int num = 0;
+  for (int imc=0; imc<numHepEmMCCData; ++imc) {
+    const struct G4HepEmMCCData& mccData = hepEmMCData->fMatCutData[imc];
+    elData->fBremRBEnvStartIndexPerMatCut[imc] = num;
+    for (int jmc=0; jmc<imc; ++jmc) {
+      const struct G4HepEmMCCData& mccDataJ = hepEmMCData->fMatCutData[jmc];
+      if (mccDataJ.fHepEmMatIndex == mccData.fHepEmMatIndex && mccDataJ.fSecGamProdCutE == mccData.fSecGamProdCutE) {
+        elData->fBremRBEnvStartIndexPerMatCut[imc] = elData->fBremRBEnvStartIndexPerMatCut[jmc];
+        break;
+      }
+    }
+    if (elData->fBremRBEnvStartIndexPerMatCut[imc] == num) {
+      num += hepEmMatData->fMaterialData[mccData.fHepEmMatIndex].fNumOfElement*numEkin*numBins;
+    }
+  }
+  elData->fBremRBEnvNumData = num;
+  delete[] elData->fBremRBEnvData;
+  elData->fBremRBEnvData = new G4double[num]{};
+  //
+  // build the envelopes using the same rejection function and transformed
+  // variable as G4HepEmElectronInteractionBrem::SampleETransferRB
+  for (int imc=0; imc<numHepEmMCCData; ++imc) {
+    // skip couples that share the envelopes of an earlier one
+    const int iStart = elData->fBremRBEnvStartIndexPerMatCut[imc];
+    bool isShared = false;
+    for (int jmc=0; jmc<imc && !isShared; ++jmc) {
+      isShared = (elData->fBremRBEnvStartIndexPerMatCut[jmc] == iStart);
+    }
+    if (isShared) {
+      continue;
+    }
+    const struct G4HepEmMCCData& mccData = hepEmMCData->fMatCutData[imc];
+    const struct G4HepEmMatData& matData = hepEmMatData->fMaterialData[mccData.fHepEmMatIndex];
+    const G4double     theGamCut = mccData.fSecGamProdCutE;
+    const G4double densityFactor = kMigdalConst * matData.fElectronDensity;
+    const G4double     lpmEnergy = kLPMconstant * matData.fRadiationLength;
+    const G4double  lpmEnergyLim = std::sqrt(densityFactor) * lpmEnergy;
+    for (int ielem=0; ielem<matData.fNumOfElement; ++ielem) {
+      const int iZet = matData.fElementVect[ielem];
+      const struct G4HepEmElemData& elemData = hepEmElData->fElementData[std::min(iZet, hepEmElData->fMaxZet)];
+      const G4double   zFactor1 = elemData.fZFactor1;
+      const G4double   zFactor2 = (1.+1./iZet)/12.;
+      const G4double rejFuncMax = zFactor1 + zFactor2;
+      for (int ie=0; ie<numEkin; ++ie) {
+        const G4double          ekin = std::exp(elData->fBremRBEnvLogMinEkin + ie/elData->fBremRBEnvEILDelta);
+        const G4double thePrimTotalE = ekin + kElectronMassC2;
+        const G4double   densityCorr = densityFactor * thePrimTotalE * thePrimTotalE;
+        const bool       isLPMActive = (thePrimTotalE > lpmEnergyLim);
+        const G4double   xmin = std::log( theGamCut*theGamCut + densityCorr );
+        const G4double xrange = std::log( ekin*ekin + densityCorr ) - xmin;
+        G4double* data = &(elData->fBremRBEnvData[iStart + (ielem*numEkin + ie)*numBins]);
+        for (int ib=0; ib<numBins; ++ib) {
+          G4double maxVal = 0.0;
+          for (int iv=0; iv<numEvals; ++iv) {
+            const G4double      u = (ib + iv/(numEvals-1.0))/numBins;
+            const G4double eGamma = std::sqrt( std::max( std::exp( xmin + u * xrange ) - densityCorr, G4double(0.0) ) );
+            const G4double    val = G4HepEmElectronInteractionBrem::ComputeDXSectionRB(eGamma, thePrimTotalE, lpmEnergy,
+                                      densityCorr, isLPMActive, iZet, elemData, zFactor1, zFactor2);
+            maxVal = std::max(maxVal, val/rejFuncMax);
+          }
+          // keep it positive (the rejection function is positive in the bin)
+          data[ib] = std::min(G4double(1.0), std::max(G4double(1.0E-3), margin*maxVal));
+        }
+      }
+    }
+  }
+}
+
+
+void BuildIoniInvCDFTables(struct G4HepEmData* hepEmData, struct G4HepEmParameters* hepEmParams,
+                     bool iselectron) {
+  // get the pointer to the already allocated G4HepEmElectronData from the HepEmData
+  struct G4HepEmElectronData* elData = iselectron
+                                       ? hepEmData->fTheElectronData
+                                       : hepEmData->fThePositronData;
+  //
+  // 64 quantiles per table; the kinetic energy grid: 16 points per decade from
+  // the threshold (2x or 1x the cut for e- or e+) up to the max e-loss table energy
+  const int      numPoints  = 64;
+  const int      numPerDec  = 16;
+  const G4double maxEkin    = hepEmParams->fMaxLossTableEnergy;
+  elData->fIoniInvCDFNumPoints = numPoints;
+  //
+  const struct G4HepEmMatCutData* hepEmMCData = hepEmData->fTheMatCutData;
+  const int numHepEmMCCData = hepEmMCData->fNumMatCutData;
+  // count the number of data: couples with the same secondary e- production cut
+  // share the tables
+  delete[] elData->fIoniInvCDFStartIndexPerMatCut;
+  elData->fIoniInvCDFStartIndexPerMatCut = new int[numHepEmMCCData];
+  int num = 0;
+  for (int imc=0; imc<numHepEmMCCData; ++imc) {
+    const G4double elCut = hepEmMCData->fMatCutData[imc].fSecElProdCutE;
+    elData->fIoniInvCDFStartIndexPerMatCut[imc] = num;
+    for (int jmc=0; jmc<imc; ++jmc) {
+      if (hepEmMCData->fMatCutData[jmc].fSecElProdCutE == elCut) {
+        elData->fIoniInvCDFStartIndexPerMatCut[imc] = elData->fIoniInvCDFStartIndexPerMatCut[jmc];
+        break;
+      }
+    }
+    if (elData->fIoniInvCDFStartIndexPerMatCut[imc] == num) {
+      const G4double minEkin = iselectron ? 2.0*elCut : elCut;
+      const int      numEkin = std::max(2, (int)std::ceil(numPerDec*std::log10(GET_VALUE(maxEkin/minEkin)))+1);
+      num += 3 + numEkin*numPoints;
+    }
+  }
+  elData->fIoniInvCDFNumData = num;
+  delete[] elData->fIoniInvCDFData;
+  elData->fIoniInvCDFData = new G4double[num]{};
+  //
+  for (int imc=0; imc<numHepEmMCCData; ++imc) {
+    // skip couples that share the tables of an earlier one
+    const int iStart = elData->fIoniInvCDFStartIndexPerMatCut[imc];
+    bool isShared = false;
+    for (int jmc=0; jmc<imc && !isShared; ++jmc) {
+      isShared = (elData->fIoniInvCDFStartIndexPerMatCut[jmc] == iStart);
+    }
+    if (isShared) {
+      continue;
+    }
+    const G4double   elCut = hepEmMCData->fMatCutData[imc].fSecElProdCutE;
+    const G4double minEkin = iselectron ? 2.0*elCut : elCut;
+    const int      numEkin = std::max(2, (int)std::ceil(numPerDec*std::log10(GET_VALUE(maxEkin/minEkin)))+1);
+    const G4double emax    = std::max(maxEkin, G4double(2.0*minEkin));
+    G4double* data = &(elData->fIoniInvCDFData[iStart]);
+    data[0] = numEkin;
+    data[1] = std::log(minEkin);
+    data[2] = (numEkin-1)/std::log(emax/minEkin);
+    for (int ie=0; ie<numEkin; ++ie) {
+      const G4double ekin = std::exp(data[1] + ie/data[2]);
+      BuildIoniInvCDFTable(ekin, elCut, iselectron, numPoints, &(data[3 + ie*numPoints]));
+    }
+  }
+}
+
+
+// builds the inverse CDF of the Moller (e-) or Bhabha (e+) fractional energy
+// transfer x in the envelope variable z (x = xmin*xmax/[xmin(1-z)+xmax*z]) at
+// the u_k = [k/(K-1)]^4, k=0,...,K-1 (K = `numPoints`) quantiles. The CDF is
+// computed on a fine grid, equally spaced in ln(x) from xmax down to xmin, as
+// the envelope (1/x^2) mass of each bin times the rejection function at its
+// (geometric) middle and inverted by using the envelope shape inside the bins.
+void BuildIoniInvCDFTable(G4double ekin, G4double elCut, bool iselectron, int numPoints, G4double* data) {
+  const G4double xmax = iselectron ? 0.5 : 1.0;
+  const G4double xmin = std::min(G4double(elCut/ekin), xmax);
+  // the range is (numerically) zero at the threshold: the envelope itself
+  if (xmax - xmin < 1.0E-12*xmax) {
+    for (int k=0; k<numPoints; ++k) {
+      const G4double u = (G4double)k/(numPoints-1);
+      data[k] = u*u*u*u;
+    }
+    return;
+  }
+  const int numFine = 4096;
+  std::vector<G4double> theCDF(numFine+1, 0.0);
+  std::vector<G4double> theXs(numFine+1, xmax);
+  const G4double logRange = std::log(xmax/xmin);
+  for (int j=1; j<=numFine; ++j) {
+    theXs[j] = (j == numFine) ? xmin : xmax*std::exp(-logRange*j/numFine);
+    const G4double xm = std::sqrt(theXs[j]*theXs[j-1]);
+    const G4double rf = iselectron
+                        ? G4HepEmElectronInteractionIoni::ComputeRejFuncMoller(xm, ekin)
+                        : G4HepEmElectronInteractionIoni::ComputeRejFuncBhabha(xm, ekin);
+    theCDF[j] = theCDF[j-1] + rf*(1.0/theXs[j] - 1.0/theXs[j-1]);
+  }
+  int j = 0;
+  for (int k=0; k<numPoints; ++k) {
+    const G4double u = (G4double)k/(numPoints-1);
+    const G4double q = theCDF[numFine]*u*u*u*u;
+    while (j < numFine-1 && theCDF[j+1] < q) {
+      ++j;
+    }
+    const G4double dCDF = theCDF[j+1] - theCDF[j];
+    G4double f = 0.0;
+    if (dCDF > 0.0) {
+      f = (q - theCDF[j])/dCDF;
+    }
+    const G4double x = 1.0/(1.0/theXs[j] + f*(1.0/theXs[j+1] - 1.0/theXs[j]));
+    const G4double z = (xmax/x - 1.0)*xmin/(xmax - xmin);
+    data[k] = std::max(G4double(0.0), std::min(G4double(1.0), z));
+  }
+  data[0]           = 0.0;
+  data[numPoints-1] = 1.0;
+}
+
+
 void BuildElementSelectorTables(G4MollerBhabhaModel* mbModel, G4SeltzerBergerModel* sbModel,
                        G4eBremsstrahlungRelModel* rbModel, struct G4HepEmData* hepEmData,
                        struct G4HepEmParameters* hepEmParams, bool iselectron) {
@@ -470,6 +932,10 @@ void BuildElementSelectorTables(G4MollerBhabhaModel* mbModel, G4SeltzerBergerMod
   int indxContIoni   = 0;
   int indxContBremSB = 0;
   int indxContBremRB = 0;
+  // the selectors already stored (to share the identical ones among mat-cuts)
+  std::unordered_multimap<std::size_t, int> ioniRegistry;
+  std::unordered_multimap<std::size_t, int> bremSBRegistry;
+  std::unordered_multimap<std::size_t, int> bremRBRegistry;
   for (int imc=0; imc<numHepEmMCCData; ++imc) {
     // get the hepEm mat-cut and material structures
     const struct G4HepEmMCCData& mccData  = hepEmMCData->fMatCutData[imc];
@@ -498,6 +964,7 @@ void BuildElementSelectorTables(G4MollerBhabhaModel* mbModel, G4SeltzerBergerMod
       // fill in the first values as #data
       elData->fElemSelectorIoniStartIndexPerMatCut[imc] = indxContIoni;
       BuildElementSelector(minEKin, maxEKin, numBinsPerDecade, ioniData, indxContIoni, matData, mbModel, elCutE, g4PartDef);
+      ShareIdenticalSelector(ioniData, indxContIoni, elData->fElemSelectorIoniStartIndexPerMatCut[imc], ioniRegistry);
     }
     //
     // ===== Brem: Seltzer-Berger
@@ -511,6 +978,7 @@ void BuildElementSelectorTables(G4MollerBhabhaModel* mbModel, G4SeltzerBergerMod
     } else  {
       elData->fElemSelectorBremSBStartIndexPerMatCut[imc] = indxContBremSB;
       BuildElementSelector(minEKin, maxEKin, numBinsPerDecade, bremSBData, indxContBremSB, matData, sbModel, gamCutE, g4PartDef);
+      ShareIdenticalSelector(bremSBData, indxContBremSB, elData->fElemSelectorBremSBStartIndexPerMatCut[imc], bremSBRegistry);
     }
     //
     // ===== Brem: Relativistic
@@ -524,7 +992,7 @@ void BuildElementSelectorTables(G4MollerBhabhaModel* mbModel, G4SeltzerBergerMod
     } else  {
       elData->fElemSelectorBremRBStartIndexPerMatCut[imc] = indxContBremRB;
       BuildElementSelector(minEKin, maxEKin, numBinsPerDecade, bremRBData, indxContBremRB, matData, rbModel, gamCutE, g4PartDef);
-
+      ShareIdenticalSelector(bremRBData, indxContBremRB, elData->fElemSelectorBremRBStartIndexPerMatCut[imc], bremRBRegistry);
     }
   }
 
@@ -560,6 +1028,17 @@ void BuildElementSelectorTables(G4MollerBhabhaModel* mbModel, G4SeltzerBergerMod
 }
 
 
+void ShareIdenticalSelector(const G4double* data, int& indxCont, int& startIndex,
+                            std::unordered_multimap<std::size_t, int>& registry) {
+  const int iShared = G4HepEmInitUtils::ShareIdenticalData(data, startIndex, indxCont-startIndex, registry);
+  if (iShared != startIndex) {
+    // identical to an earlier one: use that and drop the one just built
+    indxCont   = startIndex;
+    startIndex = iShared;
+  }
+}
+
+
 void BuildElementSelector(G4double minEKin, G4double maxEKin, int numBinsPerDecade, G4double *data, int& indxCont, const struct G4HepEmMatData& matData, G4VEmModel* emModel, G4double cut, const G4ParticleDefinition* g4PartDef) {
   int     numElem    = matData.fNumOfElement;
   G4double  logMinEKin = 0.0;
@@ -761,3 +1240,20 @@ void BuildSBBremSTables(struct G4HepEmData* hepEmData, struct G4HepEmParameters*
     }
   }
 }
+
+
+void BuildFloat32Tables(struct G4HepEmData* hepEmData, bool iselectron) {
+  G4HepEmElectronData* elData = iselectron ? hepEmData->fTheElectronData : hepEmData->fThePositronData;
+  const int numELossData  = 5*elData->fELossEnergyGridSize*elData->fNumMatCuts;
+  const int numTr1XSecData = 2*elData->fELossEnergyGridSize*elData->fNumMaterials;
+  delete[] elData->fELossDataF32;
+  delete[] elData->fResMacXSecDataF32;
+  delete[] elData->fTr1MacXSecDataF32;
+  delete[] elData->fElemSelectorBremSBDataF32;
+  delete[] elData->fElemSelectorBremRBDataF32;
+  elData->fELossDataF32       = G4HepEmInitUtils::MakeFloatCopy(numELossData, elData->fELossData);
+  elData->fResMacXSecDataF32  = G4HepEmInitUtils::MakeFloatCopy(elData->fResMacXSecNumData, elData->fResMacXSecData);
+  elData->fTr1MacXSecDataF32  = G4HepEmInitUtils::MakeFloatCopy(numTr1XSecData, elData->fTr1MacXSecData);
+  elData->fElemSelectorBremSBDataF32 = G4HepEmInitUtils::MakeFloatCopy(elData->fElemSelectorBremSBNumData, elData->fElemSelectorBremSBData);
+  elData->fElemSelectorBremRBDataF32 = G4HepEmInitUtils::MakeFloatCopy(elData->fElemSelectorBremRBNumData, elData->fElemSelectorBremRBData);
+}
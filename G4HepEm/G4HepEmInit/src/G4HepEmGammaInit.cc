@@ -26,7 +26,7 @@
 #include <iostream>
 
 
-void InitGammaData(struct G4HepEmData* hepEmData, struct G4HepEmParameters* /*hepEmPars*/) {
+void InitGammaData(struct G4HepEmData* hepEmData, struct G4HepEmParameters* hepEmPars) {
   // clean previous G4HepEmElectronData (if any)
   //
   // create G4Models for gamma
@@ -66,6 +66,34 @@ void InitGammaData(struct G4HepEmData* hepEmData, struct G4HepEmParameters* /*he
   // build element selectors
   std::cout << "     ---  BuildElementSelectorTables ... " << std::endl;
   BuildElementSelectorTables(modelPP, hepEmData);
+  // build the photoelectric tables
+  std::cout << "     ---  BuildPhotoElectricTables ... " << std::endl;
+  BuildPhotoElectricTables(hepEmData);
+  // build the fused macroscopic cross section table if required
+  if (hepEmPars->fGammaXSecTableLayout == 1) {
+    std::cout << "     ---  BuildFusedMacXSecTable ... " << std::endl;
+    BuildFusedMacXSecTable(modelPP, modelKN, hepEmData, hepEmPars);
+  }
+  // build the LPM function tables for conversion if required
+  if (hepEmPars->fUseLPMFunctionTables) {
+    std::cout << "     ---  BuildConvLPMFunctionTables ... " << std::endl;
+    BuildConvLPMFunctionTables(hepEmData);
+  }
+  // build the Klein-Nishina inverse CDF tables for Compton if required
+  if (hepEmPars->fUseCompInvCDFTables) {
+    std::cout << "     ---  BuildCompInvCDFTables ... " << std::endl;
+    BuildCompInvCDFTables(hepEmData);
+  }
+  // build the single precision copies of the tables if required
+  if (hepEmPars->fUseFloat32Tables) {
+#if defined(CODI_FORWARD) || defined(CODI_REVERSE)
+    std::cerr << " *** G4HepEm InitGammaData: single precision tables are not supported"
+              << " in the AD build (the double precision tables are used)." << std::endl;
+#else
+    std::cout << "     ---  BuildFloat32Tables ... " << std::endl;
+    BuildFloat32Tables(hepEmData);
+#endif
+  }
   //
   // delete all g4 models
   // NOTE: I don't delete this because something is crashing in G4
@@ -8,8 +8,10 @@
 #include "G4HepEmGammaData.hh"
 
 #include "G4HepEmParameters.hh"
+#include "G4HepEmConstants.hh"
 
 #include "G4HepEmInitUtils.hh"
+#include "G4HepEmInteractionUtils.hh"
 
 
 // g4 includes
@@ -24,7 +26,9 @@
 #include "G4NistManager.hh"
 #include "G4EmParameters.hh"
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 void BuildLambdaTables(G4PairProductionRelModel* ppModel, G4KleinNishinaCompton* knModel,
                      struct G4HepEmData* hepEmData) {
@@ -197,3 +201,302 @@ void BuildElementSelectorTables(G4PairProductionRelModel* ppModel, struct G4HepE
     }
   }
 }
+
+
+// photoelectric tables: the Sandia parametrisation is kept (so the macroscopic
+// cross section is exact) but the material and element Sandia intervals are
+// resolved at initialisation on a set of energy knots that includes all the
+// absorption edges
+void BuildPhotoElectricTables(struct G4HepEmData* hepEmData) {
+  // get the pointer to the already allocated G4HepEmGammaData from the HepEmData
+  struct G4HepEmGammaData* gmData = hepEmData->fTheGammaData;
+  //
+  // == Generate the (uniform) log-energy lookup grid
+  const G4double emin = 10.0*CLHEP::eV;
+  const G4double emax = 100.0*CLHEP::TeV;
+  const int numPEEkin = gmData->fPEEnergyGridSize;
+  const int numBins   = numPEEkin - 1;
+  std::vector<G4double> theEGrid(numPEEkin, 0.0);
+  G4HepEmInitUtils::FillLogarithmicGrid(emin, emax, numPEEkin, gmData->fPELogMinEkin, gmData->fPEEILDelta, theEGrid.data());
+  //
+  const struct G4HepEmMaterialData* hepEmMatData  = hepEmData->fTheMaterialData;
+  const struct G4HepEmElementData*  hepEmElemData = hepEmData->fTheElementData;
+  const int numHepEmMatData = hepEmMatData->fNumMaterialData;
+  // index of the Sandia interval that is used at `ekin` (same as at run time)
+  auto sandiaInterval = [](const G4double* energies, int num, G4double ekin) -> int {
+    for (int i=num-1; i>0; --i) {
+      if (ekin >= energies[i]) {
+        return i;
+      }
+    }
+    return 0;
+  };
+  auto sandiaXSec = [](const G4double* cof, G4double ekin) -> G4double {
+    const G4double inv = 1.0/ekin;
+    return inv*(cof[0] + inv*(cof[1] + inv*(cof[2] + inv*cof[3])));
+  };
+  // == Collect the knots of all materials and count the data
+  std::vector< std::vector<G4double> > theKnots(numHepEmMatData);
+  int numData = 0;
+  for (int im=0; im<numHepEmMatData; ++im) {
+    const struct G4HepEmMatData& matData = hepEmMatData->fMaterialData[im];
+    std::vector<G4double>& knots = theKnots[im];
+    knots = theEGrid;
+    knots.insert(knots.end(), matData.fSandiaEnergies, matData.fSandiaEnergies+matData.fNumOfSandiaIntervals);
+    for (int iz=0; iz<matData.fNumOfElement; ++iz) {
+      const struct G4HepEmElemData& elemData = hepEmElemData->fElementData[matData.fElementVect[iz]];
+      knots.insert(knots.end(), elemData.fSandiaEnergies, elemData.fSandiaEnergies+elemData.fNumOfSandiaIntervals);
+    }
+    std::sort(knots.begin(), knots.end());
+    knots.erase(std::unique(knots.begin(), knots.end()), knots.end());
+    const int numElem = matData.fNumOfElement;
+    const int stride  = 5 + (numElem > 1 ? 2*(numElem-1) : 0);
+    numData += 2 + stride*(int)knots.size();
+  }
+  //
+  // == Allocate and fill
+  gmData->fPENumData = numData;
+  delete[] gmData->fPEStartIndexPerMat;
+  delete[] gmData->fPEBinKnotIndex;
+  delete[] gmData->fPEData;
+  gmData->fPEStartIndexPerMat = new int[numHepEmMatData]{};
+  gmData->fPEBinKnotIndex     = new int[numHepEmMatData*numBins]{};
+  gmData->fPEData             = new G4double[numData]{};
+  std::vector<G4double> cumStart;
+  std::vector<G4double> cumEnd;
+  int indxCont = 0;
+  for (int im=0; im<numHepEmMatData; ++im) {
+    const struct G4HepEmMatData& matData = hepEmMatData->fMaterialData[im];
+    const std::vector<G4double>& knots = theKnots[im];
+    const int numKnots = (int)knots.size();
+    const int numElem  = matData.fNumOfElement;
+    gmData->fPEStartIndexPerMat[im] = indxCont;
+    gmData->fPEData[indxCont++] = numKnots;
+    gmData->fPEData[indxCont++] = numElem;
+    for (int ik=0; ik<numKnots; ++ik) {
+      const G4double ekin = knots[ik];
+      gmData->fPEData[indxCont++] = ekin;
+      const G4double* cof = &matData.fSandiaCoefficients[4*sandiaInterval(matData.fSandiaEnergies, matData.fNumOfSandiaIntervals, ekin)];
+      for (int i=0; i<4; ++i) {
+        gmData->fPEData[indxCont++] = cof[i];
+      }
+      if (numElem < 2) {
+        continue;
+      }
+      // the element selector at the lower (i.e. just above the edge) and upper
+      // (i.e. just below the next knot) ends of this knot interval: the Sandia
+      // intervals of the elements do not change within a knot interval
+      const G4double ekinEnd = ik+1 < numKnots ? knots[ik+1] : ekin;
+      cumStart.assign(numElem, 0.0);
+      cumEnd.assign(numElem, 0.0);
+      G4double sumStart = 0.0;
+      G4double sumEnd   = 0.0;
+      for (int iz=0; iz<numElem; ++iz) {
+        const struct G4HepEmElemData& elemData = hepEmElemData->fElementData[matData.fElementVect[iz]];
+        const G4double* ecof = &elemData.fSandiaCoefficients[4*sandiaInterval(elemData.fSandiaEnergies, elemData.fNumOfSandiaIntervals, ekin)];
+        const G4double natoms = matData.fNumOfAtomsPerVolumeVect[iz];
+        sumStart += natoms*std::max(0.0, sandiaXSec(ecof, ekin));
+        sumEnd   += natoms*std::max(0.0, sandiaXSec(ecof, ekinEnd));
+        cumStart[iz] = sumStart;
+        cumEnd[iz]   = sumEnd;
+      }
+      const G4double normStart = sumStart > 0.0 ? (G4double)(1.0/sumStart) : 0.0;
+      const G4double normEnd   = sumEnd   > 0.0 ? (G4double)(1.0/sumEnd)   : 0.0;
+      for (int iz=0; iz<numElem-1; ++iz) {
+        gmData->fPEData[indxCont++] = cumStart[iz]*normStart;
+      }
+      for (int iz=0; iz<numElem-1; ++iz) {
+        gmData->fPEData[indxCont++] = cumEnd[iz]*normEnd;
+      }
+    }
+    // the lookup: last knot that is not above the lower edge of each bin
+    int* binKnotIndex = &gmData->fPEBinKnotIndex[im*numBins];
+    int ik = 0;
+    for (int ib=0; ib<numBins; ++ib) {
+      while (ik+1 < numKnots && knots[ik+1] <= theEGrid[ib]) {
+        ++ik;
+      }
+      binKnotIndex[ib] = ik;
+    }
+  }
+}
+
+
+// fused table: the conversion, Compton, photoelectric and total macroscopic
+// cross sections at each knot of a common log-energy grid (interleaved) so all
+// of them can be obtained by a single index computation at run time
+void BuildFusedMacXSecTable(G4PairProductionRelModel* ppModel, G4KleinNishinaCompton* knModel,
+                            struct G4HepEmData* hepEmData, struct G4HepEmParameters* hepEmPars) {
+  // get the pointer to the already allocated G4HepEmGammaData from the HepEmData
+  struct G4HepEmGammaData* gmData = hepEmData->fTheGammaData;
+  //
+  // == Generate the common enegry grid
+  const G4double emin = 100.0*CLHEP::eV;
+  const G4double emax = 100.0*CLHEP::TeV;
+  const int numBinsPerDecade = std::max(1, hepEmPars->fNumGammaFusedTableBinsPerDecade);
+  const int numEkin = (int)GET_VALUE(numBinsPerDecade*std::log10(emax/emin) + 0.5) + 1;
+  gmData->fFusedEnergyGridSize = numEkin;
+  delete [] gmData->fFusedEnergyGrid;
+  gmData->fFusedEnergyGrid = new G4double[numEkin]{};
+  G4HepEmInitUtils::FillLogarithmicGrid(emin, emax, numEkin, gmData->fFusedLogMinEkin, gmData->fFusedEILDelta, gmData->fFusedEnergyGrid);
+  //
+  const struct G4HepEmMatCutData*   hepEmMCData  = hepEmData->fTheMatCutData;
+  const struct G4HepEmMaterialData* hepEmMatData = hepEmData->fTheMaterialData;
+  int numHepEmMCCData   = hepEmMCData->fNumMatCutData;
+  int numHepEmMatData   = hepEmMatData->fNumMaterialData;
+  delete [] gmData->fFusedMacXsecData;
+  gmData->fFusedMacXsecData = new G4double[numHepEmMatData*numEkin*4]{};
+  std::vector<bool> isThisMatDone = std::vector<bool>(numHepEmMatData,false);
+  G4ParticleDefinition* g4PartDef = G4Gamma::Gamma();
+  G4ProductionCutsTable* theCoupleTable = G4ProductionCutsTable::GetProductionCutsTable();
+  const G4double convMinEkin = 2.0*CLHEP::electron_mass_c2;
+  for (int imc=0; imc<numHepEmMCCData; ++imc) {
+    const struct G4HepEmMCCData& mccData = hepEmMCData->fMatCutData[imc];
+    int hepEmMatIndx = mccData.fHepEmMatIndex;
+    if (isThisMatDone[hepEmMatIndx])
+      continue;
+    const G4MaterialCutsCouple* g4MatCut = theCoupleTable->GetMaterialCutsCouple(mccData.fG4MatCutIndex);
+    const struct G4HepEmMatData& matData = hepEmMatData->fMaterialData[hepEmMatIndx];
+    int indxCont = hepEmMatIndx*numEkin*4;
+    for (int ie=0; ie<numEkin; ++ie) {
+      const G4double theEKin = gmData->fFusedEnergyGrid[ie];
+      // conversion
+      const G4double xsConv = theEKin < convMinEkin ? 0.0 : std::max(0.0, ppModel->CrossSection(g4MatCut, g4PartDef, theEKin));
+      // Compton
+      const G4double xsComp = std::max(0.0, knModel->CrossSection(g4MatCut, g4PartDef, theEKin));
+      // photoelectric: Sandia parametrisation of the material (as at run time)
+      int interval = 0;
+      for (int i=matData.fNumOfSandiaIntervals-1; i>0; --i) {
+        if (theEKin >= matData.fSandiaEnergies[i]) {
+          interval = i;
+          break;
+        }
+      }
+      const G4double* cof = &matData.fSandiaCoefficients[4*interval];
+      const G4double  inv = 1.0/theEKin;
+      const G4double xsPE = std::max(0.0, inv*(cof[0] + inv*(cof[1] + inv*(cof[2] + inv*cof[3]))));
+      gmData->fFusedMacXsecData[indxCont++] = xsConv;
+      gmData->fFusedMacXsecData[indxCont++] = xsComp;
+      gmData->fFusedMacXsecData[indxCont++] = xsPE;
+      gmData->fFusedMacXsecData[indxCont++] = xsConv + xsComp + xsPE;
+    }
+    isThisMatDone[hepEmMatIndx] = true;
+  }
+}
+
+
+// LPM functions in conversion: for a given element, xi(s), G(s) and phi(s)
+// depend only on w = s'^2 = E_lpm/[8 E_g eps(1-eps)] so they are tabulated over
+// a log-grid of w (by using the same evaluation as at run time)
+void BuildConvLPMFunctionTables(struct G4HepEmData* hepEmData) {
+  // get the pointer to the already allocated G4HepEmGammaData from the HepEmData
+  struct G4HepEmGammaData* gmData = hepEmData->fTheGammaData;
+  //
+  // == Generate the w-grid
+  const G4double wmin = 1.0E-4;
+  const G4double wmax = 1.0E+6;
+  const int numW = gmData->fConvLPMGridSize;
+  std::vector<G4double> theWGrid(numW, 0.0);
+  G4HepEmInitUtils::FillLogarithmicGrid(wmin, wmax, numW, gmData->fConvLPMLogMinVar, gmData->fConvLPMILDelta, theWGrid.data());
+  //
+  // == Collect the elements used in the materials
+  const struct G4HepEmMaterialData* hepEmMatData  = hepEmData->fTheMaterialData;
+  const struct G4HepEmElementData*  hepEmElemData = hepEmData->fTheElementData;
+  const int maxZet = hepEmElemData->fMaxZet;
+  std::vector<bool> isZetUsed(maxZet+1, false);
+  int numZet = 0;
+  for (int im=0; im<hepEmMatData->fNumMaterialData; ++im) {
+    const struct G4HepEmMatData& matData = hepEmMatData->fMaterialData[im];
+    for (int iz=0; iz<matData.fNumOfElement; ++iz) {
+      const int izet = std::min(matData.fElementVect[iz], maxZet);
+      if (!isZetUsed[izet]) {
+        isZetUsed[izet] = true;
+        ++numZet;
+      }
+    }
+  }
+  //
+  // == Allocate and fill: [xi, G, phi] at each w-grid point for each element
+  gmData->fConvLPMMaxZet  = maxZet;
+  gmData->fConvLPMNumData = numZet*numW*3;
+  delete[] gmData->fConvLPMStartIndexPerZ;
+  delete[] gmData->fConvLPMData;
+  gmData->fConvLPMStartIndexPerZ = new int[maxZet+1];
+  gmData->fConvLPMData           = new G4double[gmData->fConvLPMNumData]{};
+  int indxCont = 0;
+  for (int izet=0; izet<=maxZet; ++izet) {
+    if (!isZetUsed[izet]) {
+      gmData->fConvLPMStartIndexPerZ[izet] = -1;
+      continue;
+    }
+    gmData->fConvLPMStartIndexPerZ[izet] = indxCont;
+    const struct G4HepEmElemData& elemData = hepEmElemData->fElementData[izet];
+    for (int iw=0; iw<numW; ++iw) {
+      // E_g = 1 and eps = 0.5 i.e. E_t = 0.5 gives w = E_lpm/2
+      G4double funcXiS, funcGS, funcPhiS;
+      EvaluateLPMFunctions(funcXiS, funcGS, funcPhiS, 1.0, 0.5, 2.0*theWGrid[iw], elemData.fZet23,
+                           elemData.fILVarS1, elemData.fILVarS1Cond, 0.0, -1.0);
+      gmData->fConvLPMData[indxCont++] = funcXiS;
+      gmData->fConvLPMData[indxCont++] = funcGS;
+      gmData->fConvLPMData[indxCont++] = funcPhiS;
+    }
+  }
+}
+
+
+// The Klein-Nishina DCS of the reduced post interaction photon energy eps in
+// [eps_0, 1] is transformed to t = ln(eps)/ln(eps_0) in [0,1] that gives the
+// smooth, bounded density f(t) ~ 1 + eps^2 - eps sin^2(theta). Its CDF is
+// integrated (trapezoidal) on a fine t-grid at each energy of the Compton grid
+// then inverted at the equally spaced CDF values (linear within the fine bins).
+void BuildCompInvCDFTables(struct G4HepEmData* hepEmData) {
+  G4HepEmGammaData* gmData = hepEmData->fTheGammaData;
+  const int numEkin   = gmData->fCompEnergyGridSize;
+  const int numPoints = 128;
+  const int numFine   = 4096;
+  gmData->fCompInvCDFNumPoints = numPoints;
+  delete[] gmData->fCompInvCDFData;
+  gmData->fCompInvCDFData = new G4double[numEkin*numPoints]{};
+  std::vector<G4double> theCDF(numFine+1, 0.0);
+  for (int ie=0; ie<numEkin; ++ie) {
+    const G4double kappa = gmData->fCompEnergyGrid[ie]*kInvElectronMassC2;
+    const G4double lEps0 = -std::log(1.0 + 2.0*kappa);
+    // the (not normalised) density in t
+    auto theDensity = [&](G4double t) -> G4double {
+      const G4double eps          = std::exp(t*lEps0);
+      const G4double oneMinusCost = (1.0 - eps)/(eps*kappa);
+      const G4double sint2        = oneMinusCost*(2.0 - oneMinusCost);
+      return 1.0 + eps*eps - eps*sint2;
+    };
+    const G4double delta = 1.0/numFine;
+    G4double fPrev = theDensity(0.0);
+    for (int j=1; j<=numFine; ++j) {
+      const G4double fNext = theDensity(j*delta);
+      theCDF[j] = theCDF[j-1] + 0.5*(fPrev + fNext)*delta;
+      fPrev = fNext;
+    }
+    G4double* theTable = &(gmData->fCompInvCDFData[ie*numPoints]);
+    int j = 0;
+    for (int k=0; k<numPoints; ++k) {
+      const G4double q = theCDF[numFine]*k/(numPoints - 1);
+      while (j < numFine-1 && theCDF[j+1] < q) {
+        ++j;
+      }
+      const G4double dCDF = theCDF[j+1] - theCDF[j];
+      const G4double f    = dCDF > 0.0 ? G4double((q - theCDF[j])/dCDF) : G4double(0.0);
+      theTable[k] = std::max(G4double(0.0), std::min(G4double(1.0), G4double((j + f)*delta)));
+    }
+    theTable[0]           = 0.0;
+    theTable[numPoints-1] = 1.0;
+  }
+}
+
+
+void BuildFloat32Tables(struct G4HepEmData* hepEmData) {
+  G4HepEmGammaData* gmData = hepEmData->fTheGammaData;
+  const int numConvCompData = gmData->fNumMaterials*2*(gmData->fConvEnergyGridSize+gmData->fCompEnergyGridSize);
+  delete[] gmData->fConvCompMacXsecDataF32;
+  delete[] gmData->fElemSelectorConvDataF32;
+  gmData->fConvCompMacXsecDataF32  = G4HepEmInitUtils::MakeFloatCopy(numConvCompData, gmData->fConvCompMacXsecData);
+  gmData->fElemSelectorConvDataF32 = G4HepEmInitUtils::MakeFloatCopy(gmData->fElemSelectorConvNumData, gmData->fElemSelectorConvData);
+}
@@ -4,6 +4,8 @@
 
 #include <cmath>
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 
 namespace {
 // get spline interpolation of y(x) between (x1, x2) given y_N = y(x_N), y''N(x_N) 
@@ -181,6 +183,52 @@ int    G4HepEmInitUtils::FindLowerBinIndex(G4double* xdata, int num, G4double x,
 }
 
 
+float* G4HepEmInitUtils::MakeFloatCopy(int num, const G4double* data) {
+  if (data == nullptr || num < 1) {
+    return nullptr;
+  }
+  float* theCopy = new float[num];
+  for (int i=0; i<num; ++i) {
+    theCopy[i] = (float)GET_VALUE(data[i]);
+  }
+  return theCopy;
+}
+
+
+std::size_t G4HepEmInitUtils::HashData(const G4double* data, int num) {
+  // FNV-1a over the bit patterns of the values
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (int i=0; i<num; ++i) {
+    const double val = GET_VALUE(data[i]);
+    std::uint64_t bits;
+    std::memcpy(&bits, &val, sizeof(bits));
+    hash ^= bits;
+    hash *= 1099511628211ULL;
+  }
+  return (std::size_t)hash;
+}
+
+
+int G4HepEmInitUtils::ShareIdenticalData(const G4double* data, int start, int num,
+                                         std::unordered_multimap<std::size_t, int>& registry) {
+#if defined(CODI_FORWARD) || defined(CODI_REVERSE)
+  return start;
+#else
+  const std::size_t hash = HashData(&(data[start]), num);
+  const auto range = registry.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    // NOTE: reading `num` values from an earlier (maybe shorter) table stays
+    // within the already written part of `data`
+    if (std::equal(&(data[start]), &(data[start])+num, &(data[it->second]))) {
+      return it->second;
+    }
+  }
+  registry.emplace(hash, start);
+  return start;
+#endif
+}
+
+
 void G4HepEmInitUtils::FillLogarithmicGrid(const G4double emin, const G4double emax, const int npoints, G4double& log_min_value, G4double& inverse_log_delta, G4double* grid)
 {
   G4double delta = std::log(emax/emin) / (npoints - 1);
@@ -182,6 +182,12 @@ void InitMaterialAndCoupleData(struct G4HepEmData* hepEmData, struct G4HepEmPara
           const G4double FZHigh  = 8.0*(elData.fLogZ/3.0 + elData.fCoulomb);
           elData.fDeltaMaxLow  = std::exp((42.038 - FZLow)/8.29) - 0.958;
           elData.fDeltaMaxHigh = std::exp((42.038 - FZHigh)/8.29) - 0.958;
+          // the same as used at run time in the Bethe-Heitler conversion model
+          elData.fDeltaFactorBH    = 136.0*CLHEP::electron_mass_c2/elData.fZet13;
+          elData.fFZBH[0]          = 8.0*(0.333333*elData.fLogZ);
+          elData.fFZBH[1]          = 8.0*(0.333333*elData.fLogZ + elData.fCoulomb);
+          elData.fInvDeltaMaxBH[0] = 1.0/elData.fDeltaMaxLow;
+          elData.fInvDeltaMaxBH[1] = 1.0/elData.fDeltaMaxHigh;
           G4double varS1         = elData.fZet23/(184.15*184.15);
           elData.fILVarS1Cond  = 1./(std::log(std::sqrt(2.0)*varS1));
           elData.fILVarS1      = 1./std::log(varS1);
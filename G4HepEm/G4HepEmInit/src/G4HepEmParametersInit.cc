@@ -28,4 +28,22 @@ void InitHepEmParameters(struct G4HepEmParameters* hepEmPars) {
   // range factor parameter of the MSC stepping
   hepEmPars->fMSCRangeFactor       = G4EmParameters::Instance()->MscRangeFactor();
   hepEmPars->fMSCSafetyFactor      = G4EmParameters::Instance()->MscSafetyFactor();
+
+  // gamma macroscopic cross section table layout: separate tables by default
+  hepEmPars->fGammaXSecTableLayout            = 0;
+  hepEmPars->fNumGammaFusedTableBinsPerDecade = 32;
+  // tabulated LPM functions in conversion
+  hepEmPars->fUseLPMFunctionTables            = true;
+  // double precision run-time tables
+  hepEmPars->fUseFloat32Tables                = false;
+  // analytic Urban msc angular distribution sampling
+  hepEmPars->fUseUMSCAngularTables            = false;
+  // analytic Urban msc minimum step limit and e+ theta0 correction
+  hepEmPars->fUseUMSCCorrectionTables         = false;
+  // analytic relativistic brem rejection (single maximum of the DCS)
+  hepEmPars->fUseRBBremEnvelopeTables         = false;
+  // rejection sampling of the Moller/Bhabha energy transfer
+  hepEmPars->fUseIoniInvCDFTables             = false;
+  // rejection sampling of the Compton reduced photon energy
+  hepEmPars->fUseCompInvCDFTables             = false;
 }
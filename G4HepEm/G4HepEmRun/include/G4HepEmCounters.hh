@@ -0,0 +1,196 @@
+#include "ad_type.h"
+
+#ifndef G4HepEmCounters_HH
+#define G4HepEmCounters_HH
+
+#include "G4HepEmTrack.hh"
+
+/**
+ * @file    G4HepEmCounters.hh
+ * @struct  G4HepEmCounters
+ *
+ * @brief Per-thread run-time counters of the e-/e+ and gamma stepping.
+ *
+ * Compiled in only when G4HepEm is built with the `G4HepEm_COUNTERS` CMake
+ * option: each statement that updates a counter is wrapped into the
+ * `G4HepEmCOUNT` macro that expands to nothing otherwise (and in device code).
+ * The counters of a worker are stored in its `G4HepEmTLData`, the master
+ * `G4HepEmRunManager` aggregates those of all workers and reports them (see
+ * `G4HepEmRunManager::ReportCounters`).
+ *
+ * The counters are:
+ *   - the number of steps per particle type and their distribution over the
+ *     process that limited the step (the `winner process`)
+ *   - the number of discrete e-/e+ interactions rejected by the delta
+ *     interaction check (`G4HepEmElectronManager::CheckDelta`)
+ *   - the number of calls and the total number of iterations of the rejection
+ *     loops of the Seltzer-Berger and relativistic bremsstrahlung, the
+ *     conversion and the Compton scattering final state sampling
+ *   - the number of relativistic bremsstrahlung samples at which the DCS
+ *     exceeded its tabulated rejection envelope (should be zero)
+ *   - the wall-clock time spent in tracking per particle type (measured by the
+ *     `G4HepEmTrackingManager` around the tracking of each track, so including
+ *     the geometry and the user actions) and the number of tracks
+ *   - the wall-clock time spent in the discrete interactions per particle type
+ *     and process (i.e. in the final state sampling) and their number
+ *   - the number of secondary e-/e+ and gamma tracks produced
+ */
+
+#if defined(G4HepEm_COUNTERS) && !defined(__CUDA_ARCH__)
+#define G4HepEmCOUNT(...) __VA_ARGS__
+#else
+#define G4HepEmCOUNT(...)
+#endif
+
+struct G4HepEmCounters {
+  enum Particle {
+    kElectron = 0,
+    kPositron,
+    kGamma,
+    kNumParticles
+  };
+
+  // The processes that can limit a step.
+  enum Process {
+    kTransportation = 0,
+    kContinuous,
+    kMSC,
+    kIoni,
+    kBrem,
+    kAnnihilation,
+    kConversion,
+    kCompton,
+    kPhotoElectric,
+    kNumProcesses
+  };
+
+  // The rejection loops.
+  enum Loop {
+    kLoopSBBrem = 0,
+    kLoopRBBrem,
+    kLoopConversion,
+    kLoopCompton,
+    kNumLoops
+  };
+
+  unsigned long fNumSteps[kNumParticles];
+  unsigned long fNumWinnerProcess[kNumParticles][kNumProcesses];
+  unsigned long fNumDeltaRejections[kNumParticles];
+  unsigned long fNumLoopCalls[kNumLoops];
+  unsigned long fNumLoopIterations[kNumLoops];
+  unsigned long fNumRBEnvelopeViolations;
+  unsigned long fNumTracks[kNumParticles];
+  double        fTrackingTime[kNumParticles];     // [ns]
+  unsigned long fNumInteractions[kNumParticles][kNumProcesses];
+  double        fInteractionTime[kNumParticles][kNumProcesses];  // [ns]
+  unsigned long fNumSecondaryElectrons;
+  unsigned long fNumSecondaryGammas;
+
+  G4HepEmCounters() { Reset(); }
+
+  void Reset() {
+    for (int ip=0; ip<kNumParticles; ++ip) {
+      fNumSteps[ip]           = 0;
+      fNumDeltaRejections[ip] = 0;
+      fNumTracks[ip]          = 0;
+      fTrackingTime[ip]       = 0.0;
+      for (int iw=0; iw<kNumProcesses; ++iw) {
+        fNumWinnerProcess[ip][iw] = 0;
+        fNumInteractions[ip][iw]  = 0;
+        fInteractionTime[ip][iw]  = 0.0;
+      }
+    }
+    for (int il=0; il<kNumLoops; ++il) {
+      fNumLoopCalls[il]      = 0;
+      fNumLoopIterations[il] = 0;
+    }
+    fNumRBEnvelopeViolations = 0;
+    fNumSecondaryElectrons = 0;
+    fNumSecondaryGammas    = 0;
+  }
+
+  void Add(const G4HepEmCounters& o) {
+    for (int ip=0; ip<kNumParticles; ++ip) {
+      fNumSteps[ip]           += o.fNumSteps[ip];
+      fNumDeltaRejections[ip] += o.fNumDeltaRejections[ip];
+      fNumTracks[ip]          += o.fNumTracks[ip];
+      fTrackingTime[ip]       += o.fTrackingTime[ip];
+      for (int iw=0; iw<kNumProcesses; ++iw) {
+        fNumWinnerProcess[ip][iw] += o.fNumWinnerProcess[ip][iw];
+        fNumInteractions[ip][iw]  += o.fNumInteractions[ip][iw];
+        fInteractionTime[ip][iw]  += o.fInteractionTime[ip][iw];
+      }
+    }
+    for (int il=0; il<kNumLoops; ++il) {
+      fNumLoopCalls[il]      += o.fNumLoopCalls[il];
+      fNumLoopIterations[il] += o.fNumLoopIterations[il];
+    }
+    fNumRBEnvelopeViolations += o.fNumRBEnvelopeViolations;
+    fNumSecondaryElectrons += o.fNumSecondaryElectrons;
+    fNumSecondaryGammas    += o.fNumSecondaryGammas;
+  }
+
+  static int GetParticle(const G4HepEmTrack* track) {
+    const G4double charge = track->GetCharge();
+    return charge < 0.0 ? kElectron : (charge > 0.0 ? kPositron : kGamma);
+  }
+
+  // The process that limited the step of the track: the winner process index
+  // of the track is -2 (msc), -1 (continuous), 0 (ioni), 1 (brem), 2 (annihilation)
+  // for e-/e+ and 0 (conversion), 1 (Compton), 2 (photoelectric) for gamma.
+  static int GetProcess(const G4HepEmTrack* track) {
+    const int iw = track->GetWinnerProcessIndex();
+    if (track->GetOnBoundary()) {
+      return kTransportation;
+    }
+    if (GetParticle(track) == kGamma) {
+      return iw < 0 ? kTransportation : kConversion + iw;
+    }
+    return iw == -2 ? kMSC : (iw == -1 ? kContinuous : kIoni + iw);
+  }
+
+  // Counts a step of the track.
+  void CountStep(const G4HepEmTrack* track) {
+    const int ip = GetParticle(track);
+    ++fNumSteps[ip];
+    ++fNumWinnerProcess[ip][GetProcess(track)];
+  }
+
+  // Counts a track of the given particle type and its tracking time.
+  void CountTrackingTime(int ip, double time) {
+    ++fNumTracks[ip];
+    fTrackingTime[ip] += time;
+  }
+
+  // Counts a discrete interaction of the track with the given process and its time.
+  void CountInteractionTime(const G4HepEmTrack* track, int iproc, double time) {
+    const int ip = GetParticle(track);
+    ++fNumInteractions[ip][iproc];
+    fInteractionTime[ip][iproc] += time;
+  }
+
+  void CountDeltaRejection(const G4HepEmTrack* track) { ++fNumDeltaRejections[GetParticle(track)]; }
+
+  void CountLoop(Loop loop, int numIterations) {
+    ++fNumLoopCalls[loop];
+    fNumLoopIterations[loop] += numIterations;
+  }
+
+  static const char* GetParticleName(int ip) {
+    static const char* names[kNumParticles] = {"e-", "e+", "gamma"};
+    return names[ip];
+  }
+
+  static const char* GetProcessName(int iproc) {
+    static const char* names[kNumProcesses] = {"Transportation", "Continuous", "MSC", "Ioni", "Brem",
+                                               "Annihilation", "Conversion", "Compton", "PhotoElectric"};
+    return names[iproc];
+  }
+
+  static const char* GetLoopName(int il) {
+    static const char* names[kNumLoops] = {"SB-Brem", "RB-Brem", "Conversion", "Compton"};
+    return names[il];
+  }
+};
+
+#endif // G4HepEmCounters_HH
@@ -9,6 +9,7 @@ class  G4HepEmTLData;
 class  G4HepEmRandomEngine;
 struct G4HepEmData;
 struct G4HepEmElectronData;
+struct G4HepEmElemData;
 
 
 // Bremsstrahlung interaction based on:
@@ -30,16 +31,30 @@ public:
 
 
   // Sampling of the energy transferred to the emitted photon using the numerical
-  // Seltzer-Berger DCS.
+  // Seltzer-Berger DCS. The number of iterations of the rejection loop is added
+  // to `numIterations` (if given) in builds with the run-time counters.
   G4HepEmHostDevice
   static G4double SampleETransferSB(struct G4HepEmData* hepEmData, G4double thePrimEkin, G4double theLogEkin,
-                                  int theIMCIndx, G4HepEmRandomEngine* rnge, bool iselectron);
+                                  int theIMCIndx, G4HepEmRandomEngine* rnge, bool iselectron,
+                                  int* numIterations = nullptr);
 
   // Sampling of the energy transferred to the emitted photon using the Bethe-Heitler
-  // DCS.
+  // DCS (`numIterations` as above). The rejection uses the tabulated, piecewise
+  // constant envelope of the DCS if available (see G4HepEmElectronData::fBremRBEnvData)
+  // or its single maximum otherwise. The accepted samples at which the DCS exceeds
+  // its envelope (should not happen) are added to `numEnvViolations` (if given).
   G4HepEmHostDevice
   static G4double SampleETransferRB(struct G4HepEmData* hepEmData, G4double thePrimEkin, G4double theLogEkin,
-                                  int theIMCIndx, G4HepEmRandomEngine* rnge, bool iselectron);
+                                  int theIMCIndx, G4HepEmRandomEngine* rnge, bool iselectron,
+                                  int* numIterations = nullptr, int* numEnvViolations = nullptr);
+
+  // The (rejection function form of the) Bethe-Heitler DCS used in the above
+  // sampling: its maximum is `zFactor1+zFactor2`.
+  G4HepEmHostDevice
+  static G4double ComputeDXSectionRB(const G4double eGamma, const G4double thePrimTotalE, const G4double lpmEnergy,
+                                     const G4double densityCorr, const bool isLPMActive, const int iZet,
+                                     const struct G4HepEmElemData& theElemData, const G4double zFactor1,
+                                     const G4double zFactor2);
 
 
   // Target atom selector for the above bremsstrahlung intercations in case of
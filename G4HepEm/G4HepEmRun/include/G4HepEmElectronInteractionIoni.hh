@@ -8,6 +8,7 @@
 class  G4HepEmTLData;
 class  G4HepEmRandomEngine;
 struct G4HepEmData;
+struct G4HepEmElectronData;
 
 
 // Ionisation interaction for e-/e+ described by the Moller/Bhabha model.
@@ -29,6 +30,23 @@ public:
   G4HepEmHostDevice
   static G4double SampleETransferBhabha(const G4double elCut, const G4double primEkin, G4HepEmRandomEngine* rnge);
 
+  // Rejection free sampling of the energy transferred to the secondary electron
+  // (Moller for e- and Bhabha for e+ primary) from the tabulated inverse CDF
+  // (see G4HepEmElectronData::fIoniInvCDFData) with a fixed number of operations.
+  G4HepEmHostDevice
+  static G4double SampleETransferTable(const struct G4HepEmElectronData* elData, const int theMCIndx,
+                                       const G4double elCut, const G4double primEkin, const G4double lPrimEkin,
+                                       const bool iselectron, G4HepEmRandomEngine* rnge);
+
+  // The rejection functions of the above Moller and Bhabha sampling, i.e. the
+  // DCS times x^2 with x the fractional energy transfer, up to a constant
+  // factor (the samplers use their own inlined forms). Used to build the tables.
+  G4HepEmHostDevice
+  static G4double ComputeRejFuncMoller(const G4double x, const G4double primEkin);
+
+  G4HepEmHostDevice
+  static G4double ComputeRejFuncBhabha(const G4double x, const G4double primEkin);
+
   G4HepEmHostDevice
   static void SampleDirections(const G4double thePrimEkin, const G4double deltaEkin, G4double* theSecElecDir,
                                G4double* thePrimElecDir, G4HepEmRandomEngine* rnge);
@@ -6,6 +6,7 @@
 
 struct G4HepEmData;
 struct G4HepEmParameters;
+struct G4HepEmElectronData;
 
 class  G4HepEmMSCTrackData;
 class  G4HepEmRandomEngine;
@@ -28,23 +29,39 @@ public:
 
   G4HepEmHostDevice
   static void StepLimit(G4HepEmData* hepEmData, G4HepEmParameters* hepEmPars, G4HepEmMSCTrackData* mscData,
-                        G4double ekin, int imat, G4double range, G4double presafety,
+                        G4double ekin, G4double lekin, int imat, G4double range, G4double presafety,
                         bool onBoundary, bool iselectron, G4HepEmRandomEngine* rnge);
 
   G4HepEmHostDevice
   static void SampleScattering(G4HepEmData* hepEmData, G4HepEmMSCTrackData* mscData, G4double pStepLength,
-                               G4double preStepEkin, G4double preStepTr1mfp, G4double postStepEkin, G4double postStepTr1mfp,
+                               G4double preStepEkin, G4double preStepLEkin, G4double preStepTr1mfp,
+                               G4double postStepEkin, G4double postStepLEkin, G4double postStepTr1mfp,
                                int imat, bool isElectron, G4HepEmRandomEngine* rnge);
 
 
 
 
   // auxilary method for sampling Urban MSC cos(theta) in the given step (used in the above `SampleScattering`)
+  // `theta0Corr` is the correction (factor of the step length in radiation length) used in computing theta0:
+  // one for e- and the `Theta0PositronCorrection` for e+
   G4HepEmHostDevice
   static G4double SampleCosineTheta(G4double pStepLengt, G4double preStepEkin, G4double preStepTr1mfp,
                                   G4double postStepEkin, G4double postStepTr1mfp, G4double umscTlimitMin,
-                                  G4double radLength, G4double zeff, const G4double* umscTailCoeff, const G4double* umscThetaCoeff,
-                                  bool isElectron, G4HepEmRandomEngine* rnge);
+                                  G4double radLength, G4double theta0Corr, const G4double* umscTailCoeff,
+                                  const G4double* umscThetaCoeff, G4HepEmRandomEngine* rnge);
+
+  // auxilary method for sampling cos(theta) from the (optional) tabulated angular distributions (see
+  // G4HepEmElectronData::fUMSCAngularData) at the given (mean) log kinetic energy and `tau` (used in the
+  // above `SampleScattering` instead of `SampleCosineTheta` when the tables are available and the step is
+  // within their validity). Returns false (without setting `cost`) if the model changes between the
+  // neighbouring tau grid points, i.e. the analytic sampling needs to be used.
+  G4HepEmHostDevice
+  static bool SampleCosineThetaTable(const struct G4HepEmElectronData* elData, int imat, G4double lekin,
+                                     G4double tau, G4double ltau, G4double& cost, G4HepEmRandomEngine* rnge);
+
+  // auxilary method for computing the step length in (energy dependent) first transport mean free path
+  G4HepEmHostDevice
+  static G4double ComputeTau(G4double pStepLength, G4double preStepTr1mfp, G4double postStepTr1mfp);
 
   // auxilary method for sampling cos(theta) in a simplified way: using an arbitrary pdf with correct mean and stdev
   // (used in the above `SampleCosineTheta`)
@@ -54,12 +71,25 @@ public:
   // auxilary method for computing theta0 (used in the above `SampleCosineTheta`)
   G4HepEmHostDevice
   static G4double ComputeTheta0(G4double stepInRadLength, G4double postStepEkin, G4double preStepEkin,
-                              G4double zeff, const G4double* umscThetaCoeff, bool isElectron);
+                              G4double theta0Corr, const G4double* umscThetaCoeff);
 
-  // auxilary method for computing the e+ correction to theta0 (used in the above `ComputeTheta0` but only in case of e+)
+  // auxilary method for computing the e+ correction to theta0 (used in `SampleScattering` but only in case of e+
+  // and if not tabulated in G4HepEmElectronData::fUMSCTheta0CorrData)
   G4HepEmHostDevice
   static G4double Theta0PositronCorrection(G4double eekin, G4double zeff);
 
+  // auxilary method for computing the ratio of the minimum true step limit to the first transport mean free
+  // path (used in `StepLimit` if not tabulated in G4HepEmElectronData::fUMSCTlimitMinData)
+  G4HepEmHostDevice
+  static G4double ComputeTlimitMinFactor(G4double ekin, G4double zeff23, G4double zeffSqrt,
+                                         const G4double* umscStepMinPars, bool iselectron);
+
+  // auxilary method for setting the new direction (with the sampled `cost` and a uniform azimuthal angle)
+  // and sampling the dispacement (if any) at the end of `SampleScattering`
+  G4HepEmHostDevice
+  static void SetNewDirectionAndDisplacement(G4double cost, G4double pStepLength, G4HepEmMSCTrackData* mscData,
+                                             G4HepEmRandomEngine* rnge);
+
   // auxilary method for sampling the lateral displacement vector (x,y,0) on a rather approximate way
   G4HepEmHostDevice
   static void   SampleDisplacement(G4double pStepLengt, G4double thePhi, G4HepEmMSCTrackData* mscData, G4HepEmRandomEngine* rnge);
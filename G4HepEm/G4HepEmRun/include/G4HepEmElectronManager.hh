@@ -195,6 +195,23 @@ public:
   G4HepEmHostDevice
   static bool CheckDelta(struct G4HepEmData* hepEmData, G4HepEmTrack* theTrack, G4double rand);
 
+  /** Function that issues software prefetch hints for the table rows the next steps of the track will use.
+    *
+    * Can be invoked when the physics step limit, i.e. the winner discrete process, is known (after `HowFar`)
+    * and before the geometry step (or, in batched processing, a few tracks ahead) so the cache lines are
+    * loaded while other work is done instead of on demand later. It covers the range and dE/dx rows at the
+    * current energy bin (used by `GetRestRange`, `GetRestDEDX` and `GetInvRange`), the header of the restricted
+    * macroscopic cross sections of the material-cuts and, if bremsstrahlung is the winner, its target element
+    * selector data or (for single element materials) the start of the Seltzer-Berger table of that Z.
+    * It has no effect on the results.
+    *
+    * @param hepEmData pointer to the top level, global, G4HepEmData structure.
+    * @param hepEmPars pointer to the global, G4HepEmParameters structure.
+    * @param theTrack pointer to the input information of the track.
+    */
+  G4HepEmHostDevice
+  static void PrefetchTables(struct G4HepEmData* hepEmData, struct G4HepEmParameters* hepEmPars, G4HepEmTrack* theTrack);
+
   /** Functions that performs the discrete interaction for a given e-/e+ particle.
     *
     * @param hepEmData pointer to the top level, global, G4HepEmData structure.
@@ -0,0 +1,104 @@
+#include "ad_type.h"
+
+#ifndef G4HepEmElectronPipeline_HH
+#define G4HepEmElectronPipeline_HH
+
+#include <vector>
+
+struct G4HepEmData;
+struct G4HepEmParameters;
+
+class  G4HepEmTLData;
+class  G4HepEmElectronTrack;
+
+/**
+ * @file    G4HepEmElectronPipeline.hh
+ * @class   G4HepEmElectronPipeline
+ *
+ * @brief Stage based (interaction queue) e-/e+ stepping of a batch of tracks.
+ *
+ * The stages of the e-/e+ stepping, that `G4HepEmElectronManager::Perform`
+ * executes one after the other for a single track, are run here as independent
+ * stages over a whole batch of tracks (a store of `G4HepEmElectronTrack`-s):
+ *
+ *   - `kHowFar`: sampling the `number-of-interaction-left` and the physics step
+ *     limit (`G4HepEmElectronManager::HowFar`)
+ *   - `kContinuous`: continuous step limit update, energy loss, MSC and energy
+ *     loss fluctuation (`G4HepEmElectronManager::PerformContinuous`) followed by
+ *     the delta interaction check (`G4HepEmElectronManager::CheckDelta`)
+ *   - `kIoni`, `kBrem`, `kAnnihilation`: the discrete interactions
+ *   - `kAnnihilationAtRest`: annihilation of the e+-s stopped in the step
+ *
+ * Each stage has its own queue of track indices (into the track store) and is
+ * executed over its whole queue. The scheduler part of `Perform` moves the
+ * tracks from the continuous stage into the queue of their discrete interaction
+ * (or to none, if the step was not limited by a real discrete interaction). So
+ * each stage sees homogeneous work, and the number of tracks processed and the
+ * time spent in each stage are recorded so they can be measured and tuned
+ * separately.
+ *
+ * The geometry step is not part of the pipeline: `HowFar` must be followed by
+ * the propagation of all the tracks (setting their geometrical step length and
+ * `OnBoundary` flag) before `Perform` is invoked. The secondaries of the whole
+ * batch are delivered in the secondary track buffers of the input G4HepEmTLData
+ * (that are reset at the beginning of `Perform`, so they need to be processed
+ * before the next `Perform`) with the parent ID set to the ID of their primary.
+ * The buffers are reserved for the worst case before each discrete stage.
+ *
+ * While a stage iterates over its tracks, the table rows used by the track
+ * `prefetch distance` ahead are requested by software prefetch hints (see
+ * `G4HepEmElectronManager::PrefetchTables`) so their loading overlaps with the
+ * processing of the tracks in between. A distance of 0 disables prefetching.
+ *
+ * @note The track store is an array of the ordinary G4HepEmElectronTrack-s (so
+ *       the state is compatible with all the other components) while the stage
+ *       queues are plain index arrays.
+ */
+
+class G4HepEmElectronPipeline {
+public:
+  enum Stage {
+    kHowFar = 0,
+    kContinuous,
+    kIoni,
+    kBrem,
+    kAnnihilation,
+    kAnnihilationAtRest,
+    kNumStages
+  };
+
+  G4HepEmElectronPipeline();
+
+  // Physics step limit of all the `numTracks` tracks.
+  void HowFar(struct G4HepEmData* hepEmData, struct G4HepEmParameters* hepEmPars,
+              G4HepEmElectronTrack* tracks, int numTracks, G4HepEmTLData* tlData);
+
+  // Post step (continuous and discrete) interactions of all the `numTracks`
+  // tracks after their geometry step.
+  void Perform(struct G4HepEmData* hepEmData, struct G4HepEmParameters* hepEmPars,
+               G4HepEmElectronTrack* tracks, int numTracks, G4HepEmTLData* tlData);
+
+  // Number of tracks ahead whose tables are prefetched (0: no prefetching).
+  void SetPrefetchDistance(int val) { fPrefetchDistance = val; }
+  int  GetPrefetchDistance() const  { return fPrefetchDistance; }
+
+  // Statistics of the stages (accumulated since the last reset).
+  long   GetNumProcessed(Stage stage) const { return fNumProcessed[stage]; }
+  double GetTime(Stage stage) const { return fTime[stage]; }
+  void   ResetStatistics();
+
+  static const char* GetStageName(Stage stage);
+
+private:
+  // Runs the discrete interaction (or at rest annihilation) stage on its queue.
+  void PerformDiscreteStage(Stage stage, struct G4HepEmData* hepEmData, struct G4HepEmParameters* hepEmPars,
+                            G4HepEmElectronTrack* tracks, G4HepEmTLData* tlData);
+
+  int              fPrefetchDistance;
+  std::vector<int> fQueues[kNumStages];
+  long             fNumProcessed[kNumStages];
+  // wall clock time [s]
+  double           fTime[kNumStages];
+};
+
+#endif // G4HepEmElectronPipeline_HH
@@ -7,6 +7,9 @@
 class  G4HepEmTLData;
 class  G4HepEmRandomEngine;
 struct G4HepEmData;
+struct G4HepEmGammaData;
+struct G4HepEmGammaInteractionQueue;
+struct G4HepEmSecondaryQueue;
 
 
 // Compton scattering for gamma described by the simple Klein-Nishina model.
@@ -18,10 +21,33 @@ private:
 public:
   static void Perform(G4HepEmTLData* tlData, struct G4HepEmData* hepEmData);
 
+  // Batched `Perform` over all photons in the input queue: the post interaction
+  // photon states are written back to the queue and the secondaries are appended
+  // to the `secondaries` queue (see G4HepEmGammaInteractionQueue).
+  static void PerformQueue(struct G4HepEmData* hepEmData, struct G4HepEmGammaInteractionQueue* queue,
+                           struct G4HepEmSecondaryQueue* secondaries, G4HepEmRandomEngine* rnge);
+
   // Sampling of the post interaction photon energy and direction (already in the lab. frame)
+  // The number of iterations of the rejection loop is added to `numIterations`
+  // (if given) in builds with the run-time counters.
   G4HepEmHostDevice
   static G4double SamplePhotonEnergyAndDirection(const G4double primEkin, G4double* primDir,
-                                               const G4double* theOrgPrimGmDir, G4HepEmRandomEngine* rnge);
+                                               const G4double* theOrgPrimGmDir, G4HepEmRandomEngine* rnge,
+                                               int* numIterations = nullptr);
+
+  // Sampling of the post interaction photon energy and direction (already in the lab. frame)
+  // from the Klein-Nishina inverse CDF tables (G4HepEmGammaData::fCompInvCDFData):
+  // rejection free, i.e. fixed cost (one exp, linear interpolation in the CDF and in ln(E)).
+  G4HepEmHostDevice
+  static G4double SamplePhotonEnergyAndDirectionTable(const struct G4HepEmGammaData* gmData, const G4double primEkin,
+                                                    const G4double lPrimEkin, G4double* primDir,
+                                                    const G4double* theOrgPrimGmDir, G4HepEmRandomEngine* rnge);
+
+  // Computes the post interaction photon direction in the lab. frame from the
+  // already sampled (1-cos(theta)) and sin^2(theta) of the scattering angle.
+  G4HepEmHostDevice
+  static void ComputePhotonDirection(const G4double oneMinusCost, const G4double sint2, G4double* primDir,
+                                     const G4double* theOrgPrimGmDir, G4HepEmRandomEngine* rnge);
 };
 
 #endif  // G4HepEmGammaInteractionCompton_HH
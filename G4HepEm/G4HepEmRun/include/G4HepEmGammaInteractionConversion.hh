@@ -10,7 +10,10 @@
 class  G4HepEmTLData;
 class  G4HepEmRandomEngine;
 struct G4HepEmData;
+struct G4HepEmGammaInteractionQueue;
+struct G4HepEmSecondaryQueue;
 struct G4HepEmElemData;
+struct G4HepEmGammaData;
 
 class G4HepEmGammaInteractionConversion {
 private:
@@ -19,9 +22,16 @@ private:
 public:
   static void Perform(G4HepEmTLData* tlData, struct G4HepEmData* hepEmData);
 
+  // Batched `Perform` over all photons in the input queue: the post interaction
+  // photon states are written back to the queue and the secondaries are appended
+  // to the `secondaries` queue (see G4HepEmGammaInteractionQueue).
+  static void PerformQueue(struct G4HepEmData* hepEmData, struct G4HepEmGammaInteractionQueue* queue,
+                           struct G4HepEmSecondaryQueue* secondaries, G4HepEmRandomEngine* rnge);
+
   G4HepEmHostDevice
   static void SampleKinEnergies(struct G4HepEmData* hepEmData, G4double thePrimEkin, G4double theLogEkin,
-                                int theMCIndx, G4double& eKinEnergy, G4double& pKinEnergy, G4HepEmRandomEngine* rnge);
+                                int theMCIndx, G4double& eKinEnergy, G4double& pKinEnergy, G4HepEmRandomEngine* rnge,
+                                int* numIterations = nullptr);
 
 
   G4HepEmHostDevice
@@ -38,13 +48,21 @@ public:
   G4HepEmHostDevice
   static G4double SampleEnergyRateNoLPM(const G4double normCond, const G4double epsMin, const G4double epsRange,
                                       const G4double deltaFactor, const G4double invF10, const G4double invF20,
-                                      const G4double fz, G4HepEmRandomEngine* rnge);
+                                      const G4double fz, G4HepEmRandomEngine* rnge, int* numIterations = nullptr);
 
   G4HepEmHostDevice
   static G4double SampleEnergyRateWithLPM(const G4double normCond, const G4double epsMin, const G4double epsRange,
                                         const G4double deltaFactor, const G4double invF10, const G4double invF20,
                                         const G4double fz, G4HepEmRandomEngine* rnge, const G4double eGamma,
-                                        const G4double lpmEnergy, const struct G4HepEmElemData* elemData);
+                                        const G4double lpmEnergy, const struct G4HepEmElemData* elemData,
+                                        const struct G4HepEmGammaData* gmData, int* numIterations = nullptr);
+
+  // The LPM functions at w = s'^2 = E_lpm/[8 E_g eps(1-eps)] from the table of the
+  // given element (see G4HepEmGammaData). Returns false if `w` is below the table
+  // (the analytic evaluation needs to be used then).
+  G4HepEmHostDevice
+  static bool GetLPMFunctions(const struct G4HepEmGammaData* gmData, const G4double* lpmTable, const G4double varW,
+                              G4double& funcXiS, G4double& funcGS, G4double& funcPhiS);
 
   G4HepEmHostDevice
   static void ComputePhi12(const G4double delta, G4double &phi1, G4double &phi2);
@@ -8,6 +8,8 @@
 class  G4HepEmTLData;
 class  G4HepEmRandomEngine;
 struct G4HepEmData;
+struct G4HepEmGammaInteractionQueue;
+struct G4HepEmSecondaryQueue;
 
 
 class G4HepEmGammaInteractionPhotoelectric {
@@ -17,8 +19,14 @@ private:
 public:
   static void Perform(G4HepEmTLData* tlData, struct G4HepEmData* hepEmData);
 
+  // Batched `Perform` over all photons in the input queue: the post interaction
+  // photon states are written back to the queue and the secondaries are appended
+  // to the `secondaries` queue (see G4HepEmGammaInteractionQueue).
+  static void PerformQueue(struct G4HepEmData* hepEmData, struct G4HepEmGammaInteractionQueue* queue,
+                           struct G4HepEmSecondaryQueue* secondaries, G4HepEmRandomEngine* rnge);
+
   G4HepEmHostDevice
-  static G4double SelectElementBindingEnergy(const struct G4HepEmData* hepEmData, const int imc, const G4double mxsec, const G4double ekin, G4HepEmRandomEngine* rnge);
+  static G4double SelectElementBindingEnergy(const struct G4HepEmData* hepEmData, const int imc, const G4double ekin, const G4double lekin, G4HepEmRandomEngine* rnge);
 
   G4HepEmHostDevice
   static void SamplePhotoElectronDirection(const G4double theGammaE, const G4double* theGammaDir, G4double* theDir, G4HepEmRandomEngine* rnge);
@@ -0,0 +1,156 @@
+#include "ad_type.h"
+
+#ifndef G4HepEmGammaInteractionQueue_HH
+#define G4HepEmGammaInteractionQueue_HH
+
+/**
+ * @file    G4HepEmGammaInteractionQueue.hh
+ * @struct  G4HepEmGammaInteractionQueue
+ *
+ * @brief Structure of arrays (SoA) queues for the batched \f$\gamma\f$ interactions.
+ *
+ * Instead of dispatching one photon at a time to the interactions (see
+ * `G4HepEmGammaManager::Perform`), the photons of a whole batch, that have been
+ * stepped by the batched `G4HepEmGammaManager::HowFar`, can be sorted into per
+ * process queues (see `G4HepEmGammaManager::FillInteractionQueues`). Each queue
+ * is then processed by the `PerformQueue` kernel of the corresponding interaction
+ * (conversion, Compton and photoelectric) without any branching on the process
+ * type. The secondary \f$e^-/e^+\f$-s are written into a preallocated SoA output
+ * queue (`G4HepEmSecondaryQueue`) while the post interaction state of the photons
+ * is written back into their queue (and later to their tracks by
+ * `G4HepEmGammaManager::ScatterInteractionQueues`).
+ *
+ * The queues are grown (never shrunk) only on the host, before the kernels are
+ * invoked, so the kernels never allocate.
+ */
+
+// The input/output state of the photons that undergo the same interaction.
+struct G4HepEmGammaInteractionQueue {
+  int        fCapacity   = 0;
+  int        fSize       = 0;
+  // index of the photon in the track array the queue was filled from
+  int*       fTrackIndex = nullptr;
+  // material-cuts couple index
+  int*       fMCIndex    = nullptr;
+  // kinetic energy and its log (the post interaction energy at output)
+  G4double*  fEKin       = nullptr;
+  G4double*  fLogEKin    = nullptr;
+  // direction (the post interaction direction at output)
+  G4double*  fDirX       = nullptr;
+  G4double*  fDirY       = nullptr;
+  G4double*  fDirZ       = nullptr;
+  // energy deposit in the interaction (output)
+  G4double*  fEDeposit   = nullptr;
+};
+
+// The secondary e-/e+ produced by the interaction kernels.
+struct G4HepEmSecondaryQueue {
+  int        fCapacity    = 0;
+  int        fSize        = 0;
+  // index of the parent photon in the track array the queues were filled from
+  int*       fParentIndex = nullptr;
+  G4double*  fEKin        = nullptr;
+  G4double*  fDirX        = nullptr;
+  G4double*  fDirY        = nullptr;
+  G4double*  fDirZ        = nullptr;
+  G4double*  fCharge      = nullptr;
+};
+
+// The queues of the three gamma interactions (indexed by the process index as
+// conversion: 0, Compton: 1 and photoelectric: 2) and their secondary queue.
+struct G4HepEmGammaInteractionQueues {
+  G4HepEmGammaInteractionQueue  fProcQueues[3];
+  G4HepEmSecondaryQueue         fSecondaries;
+};
+
+
+// Makes sure that the queue can hold at least `num` photons (the content is not
+// preserved when the queue needs to grow).
+inline void ReserveGammaInteractionQueue(struct G4HepEmGammaInteractionQueue* queue, int num) {
+  if (queue->fCapacity >= num) {
+    return;
+  }
+  delete[] queue->fTrackIndex;
+  delete[] queue->fMCIndex;
+  delete[] queue->fEKin;
+  delete[] queue->fLogEKin;
+  delete[] queue->fDirX;
+  delete[] queue->fDirY;
+  delete[] queue->fDirZ;
+  delete[] queue->fEDeposit;
+  queue->fTrackIndex = new int[num];
+  queue->fMCIndex    = new int[num];
+  queue->fEKin       = new G4double[num];
+  queue->fLogEKin    = new G4double[num];
+  queue->fDirX       = new G4double[num];
+  queue->fDirY       = new G4double[num];
+  queue->fDirZ       = new G4double[num];
+  queue->fEDeposit   = new G4double[num];
+  queue->fCapacity   = num;
+  queue->fSize       = 0;
+}
+
+inline void FreeGammaInteractionQueue(struct G4HepEmGammaInteractionQueue* queue) {
+  delete[] queue->fTrackIndex;
+  delete[] queue->fMCIndex;
+  delete[] queue->fEKin;
+  delete[] queue->fLogEKin;
+  delete[] queue->fDirX;
+  delete[] queue->fDirY;
+  delete[] queue->fDirZ;
+  delete[] queue->fEDeposit;
+  *queue = G4HepEmGammaInteractionQueue();
+}
+
+// Makes sure that the queue can hold at least `num` secondaries (the content is
+// not preserved when the queue needs to grow).
+inline void ReserveSecondaryQueue(struct G4HepEmSecondaryQueue* queue, int num) {
+  if (queue->fCapacity >= num) {
+    return;
+  }
+  delete[] queue->fParentIndex;
+  delete[] queue->fEKin;
+  delete[] queue->fDirX;
+  delete[] queue->fDirY;
+  delete[] queue->fDirZ;
+  delete[] queue->fCharge;
+  queue->fParentIndex = new int[num];
+  queue->fEKin        = new G4double[num];
+  queue->fDirX        = new G4double[num];
+  queue->fDirY        = new G4double[num];
+  queue->fDirZ        = new G4double[num];
+  queue->fCharge      = new G4double[num];
+  queue->fCapacity    = num;
+  queue->fSize        = 0;
+}
+
+inline void FreeSecondaryQueue(struct G4HepEmSecondaryQueue* queue) {
+  delete[] queue->fParentIndex;
+  delete[] queue->fEKin;
+  delete[] queue->fDirX;
+  delete[] queue->fDirY;
+  delete[] queue->fDirZ;
+  delete[] queue->fCharge;
+  *queue = G4HepEmSecondaryQueue();
+}
+
+inline void FreeGammaInteractionQueues(struct G4HepEmGammaInteractionQueues* queues) {
+  for (int ip = 0; ip < 3; ++ip) {
+    FreeGammaInteractionQueue(&queues->fProcQueues[ip]);
+  }
+  FreeSecondaryQueue(&queues->fSecondaries);
+}
+
+// Appends a secondary to the queue (that must have been reserved to be large enough).
+inline void AddSecondary(struct G4HepEmSecondaryQueue* queue, int parentIndex, G4double ekin,
+                         const G4double* dir, G4double charge) {
+  const int i = queue->fSize++;
+  queue->fParentIndex[i] = parentIndex;
+  queue->fEKin[i]        = ekin;
+  queue->fDirX[i]        = dir[0];
+  queue->fDirY[i]        = dir[1];
+  queue->fDirZ[i]        = dir[2];
+  queue->fCharge[i]      = charge;
+}
+
+#endif // G4HepEmGammaInteractionQueue_HH
@@ -8,10 +8,12 @@
 struct G4HepEmData;
 struct G4HepEmParameters;
 struct G4HepEmGammaData;
+struct G4HepEmGammaInteractionQueues;
 
 class  G4HepEmTLData;
 class  G4HepEmGammaTrack;
 class  G4HepEmTrack;
+class  G4HepEmRandomEngine;
 
 /**
  * @file    G4HepEmGammaManager.hh
@@ -39,6 +41,26 @@ public:
   // interactions
   static void Perform(struct G4HepEmData* /*hepEmData*/, struct G4HepEmParameters* /*hepEmPars*/, G4HepEmTLData* /*tlData*/);
 
+
+  // batched step length and interactions of `numTracks` gamma tracks:
+  // `HowFar` samples the `number-of-interaction-left` (when needed) and computes
+  // the step length of all tracks. After the tracks have been moved (and their
+  // `OnBoundary` flag have been set), `Perform` updates the `number-of-interaction-left`
+  // of all the tracks, sorts the ones with a discrete interaction into the per
+  // process SoA queues (`FillInteractionQueues`), invokes the interaction kernels
+  // on the whole queues and writes back the post interaction states to the tracks
+  // (`ScatterInteractionQueues`). The secondaries are left in the secondary queue
+  // of `queues` (their parent index is the index of the gamma in `tracks`).
+  static void HowFar(struct G4HepEmData* hepEmData, struct G4HepEmParameters* hepEmPars, G4HepEmGammaTrack* tracks,
+                     int numTracks, G4HepEmRandomEngine* rnge);
+
+  static void Perform(struct G4HepEmData* hepEmData, struct G4HepEmParameters* hepEmPars, G4HepEmGammaTrack* tracks,
+                      int numTracks, struct G4HepEmGammaInteractionQueues* queues, G4HepEmRandomEngine* rnge);
+
+  static void FillInteractionQueues(G4HepEmGammaTrack* tracks, int numTracks, struct G4HepEmGammaInteractionQueues* queues);
+
+  static void ScatterInteractionQueues(G4HepEmGammaTrack* tracks, struct G4HepEmGammaInteractionQueues* queues);
+
   G4HepEmHostDevice
   static void UpdateNumIALeft(G4HepEmTrack* theTrack);
 
@@ -48,7 +70,49 @@ public:
                            const G4double lekin, const int iprocess);
 
   G4HepEmHostDevice
-  static G4double GetMacXSecPE(const struct G4HepEmData* hepEmData, const int imat, const G4double ekin);
+  static G4double GetMacXSecPE(const struct G4HepEmData* hepEmData, const int imat, const G4double ekin,
+                               const G4double lekin);
+
+  // Conversion, Compton and photoelectric macroscopic cross sections (in this
+  // order in `mxSecs`) from the fused table, that must be available (see
+  // G4HepEmParameters::fGammaXSecTableLayout), by a single index computation.
+  // Returns the total macroscopic cross section.
+  G4HepEmHostDevice
+  static G4double GetMacXSecsFused(const struct G4HepEmGammaData* gmData, const int imat, const G4double ekin,
+                                   const G4double lekin, G4double* mxSecs);
+
+  // Conversion, Compton and photoelectric macroscopic cross sections (in this
+  // order in `mxSecs`) and their sum, by the same table lookup that `HowFar`
+  // uses (fused, single or double precision tables, whichever is available).
+  G4HepEmHostDevice
+  static G4double GetMacXSecs(const struct G4HepEmData* hepEmData, const int imat, const G4double ekin,
+                              const G4double lekin, G4double* mxSecs);
+
+  // Index of the photoelectric knot (local to the material) that contains `ekin`
+  // (see G4HepEmGammaData): O(1) lookup on the log-energy grid followed by a step
+  // over the (few) absorption edges that might be inside the lookup bin.
+  G4HepEmHostDevice
+  static int GetPEKnotIndex(const struct G4HepEmGammaData* gmData, const int imat, const G4double ekin,
+                            const G4double lekin);
+
+  // Number of data stored per photoelectric knot in a material with `numElem` elements.
+  G4HepEmHostDevice
+  static int GetPEKnotStride(const int numElem) { return 5 + (numElem > 1 ? 2*(numElem-1) : 0); }
+
+  // Computes the total (conversion, Compton and photoelectric) macroscopic cross
+  // section at the current state (energy and mat-cut index) of the input gamma
+  // track. The mfp-s of the individual processes and the photoelectric macroscopic
+  // cross section are also set in the track (as in `HowFar`) so a subsequent
+  // `SelectInteraction` and `Perform` can be invoked on the track.
+  // Used in Woodcock tracking to decide if an interaction is real or fictitious.
+  G4HepEmHostDevice
+  static G4double GetTotalMacXSec(const struct G4HepEmData* hepEmData, G4HepEmGammaTrack* theGammaTrack);
+
+  // Selects the interaction (sets the winner process index of the track) according
+  // to the individual process mfp-s (set in `GetTotalMacXSec`) using the input
+  // random number `urnd` in [0,1).
+  G4HepEmHostDevice
+  static void SelectInteraction(G4HepEmTrack* theTrack, const G4double totalMacXSec, const G4double urnd);
 
 };
 
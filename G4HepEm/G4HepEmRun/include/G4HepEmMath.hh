@@ -19,17 +19,17 @@ auto G4HepEmX13(T x) -> decltype(std::pow(x,1./3.)) {
  return std::pow(x, 1./3.);
 }
 
-// --- Log function with VDT (G4Log) specialisations for G4double and float
+// --- Log function with VDT (G4Log) specialisations for double and float
 template <typename T>
 G4HepEmHostDevice inline
 auto G4HepEmLog(T x) -> decltype(std::log(x)) {
  return std::log(x);
 }
 // use the specialisations only on the host
-#if 0
+#ifndef __CUDA_ARCH__
 template < >
 inline
-G4double G4HepEmLog(G4double x) {
+double G4HepEmLog(double x) {
  return VDTLog(x);
 }
 template < >
@@ -39,17 +39,17 @@ float G4HepEmLog(float x) {
 }
 #endif // ndef __CUDA_ARCH__
 
-// --- Exp function with VDT (G4Exp) specialisations for G4double and float
+// --- Exp function with VDT (G4Exp) specialisations for double and float
 template <typename T>
 G4HepEmHostDevice inline
 auto G4HepEmExp(T x) -> decltype(std::exp(x)) {
  return std::exp(x);
 }
 // use the specialisations only on the host
-#if 0
+#ifndef __CUDA_ARCH__
 template < >
 inline
-G4double G4HepEmExp(G4double x) {
+double G4HepEmExp(double x) {
  return VDTExp(x);
 }
 template < >
@@ -59,17 +59,17 @@ float G4HepEmExp(float x) {
 }
 #endif // ndef __CUDA_ARCH__
 
-// --- Pow(x,a) function with the VDT (G4) Exp and Log specialisations for G4double and float
+// --- Pow(x,a) function with the VDT (G4) Exp and Log specialisations for double and float
 template <typename S, typename T>
 G4HepEmHostDevice inline
 auto G4HepEmPow(S x, T a) -> decltype(std::pow(x,a)) {
  return std::pow(x, a);
 }
 // use the specialisations only on the host
-#if 0
+#ifndef __CUDA_ARCH__
 template < >
 inline
-G4double G4HepEmPow(G4double x, G4double a) {
+double G4HepEmPow(double x, double a) {
  return VDTExp(a*VDTLog(x));
 }
 template < >
@@ -79,4 +79,91 @@ float G4HepEmPow(float x, float a) {
 }
 #endif // ndef __CUDA_ARCH__
 
+// --- AD (CoDiPack) overloads: the primal value is computed by the above VDT
+//     kernels and only the analytic derivative is recorded (as a single
+//     statement) instead of tracing through their bit manipulations. Used for
+//     `G4double` (i.e. active) arguments, expressions go to the templates above.
+#if (defined(CODI_FORWARD) || defined(CODI_REVERSE)) && !defined(__CUDA_ARCH__)
+inline
+G4double G4HepEmLog(const G4double& x) {
+ const double xv = GET_VALUE(x);
+ G4double res;
+ codi::StatementPushHelper<G4double> ph;
+ ph.startPushStatement();
+ ph.pushArgument(x, 1.0/xv);
+ ph.endPushStatement(res, VDTLog(xv));
+ return res;
+}
+
+inline
+G4double G4HepEmExp(const G4double& x) {
+ const double rv = VDTExp(GET_VALUE(x));
+ G4double res;
+ codi::StatementPushHelper<G4double> ph;
+ ph.startPushStatement();
+ ph.pushArgument(x, rv);
+ ph.endPushStatement(res, rv);
+ return res;
+}
+
+// d/dx x^a = a x^(a-1) (the exponent is passive)
+inline
+G4double G4HepEmPow(const G4double& x, double a) {
+ const double xv = GET_VALUE(x);
+ const double rv = VDTExp(a*VDTLog(xv));
+ G4double res;
+ codi::StatementPushHelper<G4double> ph;
+ ph.startPushStatement();
+ ph.pushArgument(x, a*VDTExp((a-1.0)*VDTLog(xv)));
+ ph.endPushStatement(res, rv);
+ return res;
+}
+
+// d/dx x^a = a x^(a-1) and d/da x^a = x^a ln(x)
+inline
+G4double G4HepEmPow(const G4double& x, const G4double& a) {
+ const double xv = GET_VALUE(x);
+ const double av = GET_VALUE(a);
+ const double lx = VDTLog(xv);
+ const double rv = VDTExp(av*lx);
+ G4double res;
+ codi::StatementPushHelper<G4double> ph;
+ ph.startPushStatement();
+ ph.pushArgument(x, av*VDTExp((av-1.0)*lx));
+ ph.pushArgument(a, rv*lx);
+ ph.endPushStatement(res, rv);
+ return res;
+}
+#endif // AD and ndef __CUDA_ARCH__
+
+// --- Batch version: res[i] = log(x[i]) for `n` independent values (`res` must
+//     not overlap `x`). The double version uses the branch free VDT array
+//     kernel that the compiler vectorises for the target instruction set (e.g.
+//     AVX2/AVX-512), all others the scalar function above.
+template <typename T>
+G4HepEmHostDevice inline
+void G4HepEmLogV(int n, const T* x, T* res) {
+ for (int i=0; i<n; ++i) {
+   res[i] = G4HepEmLog(x[i]);
+ }
+}
+// use the array kernel only on the host
+#if !defined(__CUDA_ARCH__) && !defined(WIN32)
+template < >
+inline
+void G4HepEmLogV(int n, const double* x, double* res) {
+ logv(n, x, res);
+}
+#endif // ndef __CUDA_ARCH__ and ndef WIN32
+
+// --- Software prefetch hint: load the cache line of `addr` for reading (no-op on the device)
+G4HepEmHostDevice static inline
+void G4HepEmPrefetch(const void* addr) {
+#if !defined(__CUDA_ARCH__) && (defined(__GNUC__) || defined(__clang__))
+ __builtin_prefetch(addr, 0, 3);
+#else
+ (void)addr;
+#endif
+}
+
 #endif // G4HepEmMath_HH
@@ -5,6 +5,9 @@
 
 #include "G4HepEmMacros.hh"
 
+class G4HepEmTrack;
+class G4HepEmRandomEngine;
+
 // Roate the direction [u,v,w] given in the scattering frame to the lab frame.
 // Details: scattering is described relative to the [0,0,1] direction (i.e. scattering
 // frame). Therefore, after the new direction is computed relative to this [0,0,1]
@@ -63,5 +66,25 @@ G4double GetSpline(G4double* data, G4double x, int idx);
 G4HepEmHostDevice
 int    FindLowerBinIndex(G4double* xdata, int num, G4double x, int step=1);
 
+// the same as above but for the single precision copies of the tables (see
+// G4HepEmParameters::fUseFloat32Tables): the data are read as float while the
+// interpolation is computed in double
+G4HepEmHostDevice
+G4double GetSplineLog(int ndata, G4double* xdata, const float* ydata, G4double x, G4double logx, G4double logxmin, G4double invLDBin);
+
+G4HepEmHostDevice
+G4double GetSplineLog(int ndata, const float* data, G4double x, G4double logx, G4double logxmin, G4double invLDBin);
+
+G4HepEmHostDevice
+G4double GetSpline(const float* xdata, G4double* ydata, const float* secderiv, G4double x, int idx, int step=1);
+
+G4HepEmHostDevice
+int    FindLowerBinIndex(const float* xdata, int num, G4double x, int step=1);
+
+// Samples the `number-of-interaction-left` of the (3) discrete processes of the
+// track where it is not set (<= 0). The random numbers are drawn in process
+// order and their -log is computed by the batch log (G4HepEmLogV).
+void SampleNumIALeft(G4HepEmTrack* theTrack, G4HepEmRandomEngine* rnge);
+
 
 #endif // G4HepEmRunUtils_HH
@@ -7,6 +7,8 @@
 #include "G4HepEmElectronTrack.hh"
 #include "G4HepEmGammaTrack.hh"
 #include "G4HepEmRandomEngine.hh"
+#include "G4HepEmMath.hh"
+#include "G4HepEmCounters.hh"
 
 #include <vector>
 
@@ -28,6 +30,8 @@
  *   - **secondary** \f$e^-/e^+\f$ and \f$\gamma\f$ **track** buffers: to propagate secondary track
  *     information (back) from the (state-less) `G4HepEmElectronManager`/`G4HepEmGammaManager` functions
  *     as well as between these particle managers and the interaction functions
+ *   - the **run-time counters** of the worker (only when built with `G4HepEm_COUNTERS`,
+ *     see `G4HepEmCounters`)
  *
  * @note
  * **All state variables** are stored in this `G4HepEmTLData` object in ``G4HepEm``.
@@ -38,12 +42,18 @@ class G4HepEmTLData {
 
 public:
 
+  // The secondary track buffers are pre-sized to `kInitialSecondaryBufferSize`
+  // that covers all the secondaries of a single interaction (and typically all
+  // the secondaries of a step) so they never need to grow in a normal shower.
+  static constexpr std::size_t kInitialSecondaryBufferSize = 16;
+
   G4HepEmTLData() {
     fRNGEngine = nullptr;
-    fElectronSecondaryTracks.resize(2);
+    fExternalElectronTrack = nullptr;
+    fElectronSecondaryTracks.resize(kInitialSecondaryBufferSize);
     fNumSecondaryElectronTracks = 0;
 
-    fGammaSecondaryTracks.resize(2);
+    fGammaSecondaryTracks.resize(kInitialSecondaryBufferSize);
     fNumSecondaryGammaTracks = 0;
   }
 
@@ -52,11 +62,17 @@ public:
   void SetRandomEngine(G4HepEmRandomEngine* rnge) { fRNGEngine = rnge; }
   G4HepEmRandomEngine* GetRNGEngine() { return fRNGEngine; }
 
-  G4HepEmElectronTrack* GetPrimaryElectronTrack()   { return &fElectronTrack; }
+  G4HepEmElectronTrack* GetPrimaryElectronTrack()   {
+    return fExternalElectronTrack != nullptr ? fExternalElectronTrack : &fElectronTrack;
+  }
+  // Makes the primary e-/e+ track to be the given, external track (e.g. a track
+  // of a batch in G4HepEmElectronPipeline) or the own track when `nullptr`.
+  void SetExternalPrimaryElectronTrack(G4HepEmElectronTrack* track) { fExternalElectronTrack = track; }
   G4HepEmElectronTrack* AddSecondaryElectronTrack() {
     if (fNumSecondaryElectronTracks==fElectronSecondaryTracks.size()) {
       fElectronSecondaryTracks.resize(2*fElectronSecondaryTracks.size());
     }
+    G4HepEmCOUNT(++fCounters.fNumSecondaryElectrons;)
     return &(fElectronSecondaryTracks[fNumSecondaryElectronTracks++]);
   }
   std::size_t GetNumSecondaryElectronTrack() { return fNumSecondaryElectronTracks; }
@@ -69,14 +85,59 @@ public:
     if (fNumSecondaryGammaTracks==fGammaSecondaryTracks.size()) {
       fGammaSecondaryTracks.resize(2*fGammaSecondaryTracks.size());
     }
+    G4HepEmCOUNT(++fCounters.fNumSecondaryGammas;)
     return &(fGammaSecondaryTracks[fNumSecondaryGammaTracks++]);
   }
   std::size_t GetNumSecondaryGammaTrack() { return fNumSecondaryGammaTracks; }
   void        ResetNumSecondaryGammaTrack() { fNumSecondaryGammaTracks = 0; }
   G4HepEmGammaTrack* GetSecondaryGammaTrack(int indx) { return &(fGammaSecondaryTracks[indx]); }
 
+  // Makes sure that both secondary buffers can hold at least `num` tracks without
+  // any further re-allocation (the buffers never shrink). Used by the batched
+  // stepping (G4HepEmElectronPipeline) before each of its discrete stages since
+  // the secondaries of a whole batch are collected in these buffers.
+  void ReserveSecondaryTracks(std::size_t num) {
+    if (fElectronSecondaryTracks.size() < num) {
+      fElectronSecondaryTracks.resize(num);
+    }
+    if (fGammaSecondaryTracks.size() < num) {
+      fGammaSecondaryTracks.resize(num);
+    }
+  }
+
+  // Computes (and sets) the log kinetic energy of all the secondary e-/e+ and
+  // gamma tracks that have not been set yet, by the batch log in blocks.
+  void ComputeSecondaryLogEKins() {
+    const int kBlockSize = 64;
+    G4double      ekin[kBlockSize];
+    G4double      logEKin[kBlockSize];
+    G4HepEmTrack* tracks[kBlockSize];
+    int numInBlock = 0;
+    const int numElectrons = (int)fNumSecondaryElectronTracks;
+    const int numAll       = numElectrons + (int)fNumSecondaryGammaTracks;
+    for (int is=0; is<numAll; ++is) {
+      G4HepEmTrack* theTrack = is < numElectrons
+                               ? fElectronSecondaryTracks[is].GetTrack()
+                               : fGammaSecondaryTracks[is-numElectrons].GetTrack();
+      if (!theTrack->IsLogEKinSet() && theTrack->GetEKin() > 0.) {
+        ekin[numInBlock]     = theTrack->GetEKin();
+        tracks[numInBlock++] = theTrack;
+      }
+      if (numInBlock == kBlockSize || (is == numAll-1 && numInBlock > 0)) {
+        G4HepEmLogV(numInBlock, ekin, logEKin);
+        for (int i=0; i<numInBlock; ++i) {
+          tracks[i]->SetLEKin(logEKin[i]);
+        }
+        numInBlock = 0;
+      }
+    }
+  }
 
 
+#ifdef G4HepEm_COUNTERS
+  G4HepEmCounters& GetCounters() { return fCounters; }
+#endif
+
 private:
 
   // needs to set to point to the RNG engine of the thread
@@ -84,12 +145,17 @@ private:
 
   std::size_t                        fNumSecondaryElectronTracks;
   G4HepEmElectronTrack               fElectronTrack;
+  G4HepEmElectronTrack*              fExternalElectronTrack;
   std::vector<G4HepEmElectronTrack>  fElectronSecondaryTracks;
 
   std::size_t                        fNumSecondaryGammaTracks;
   G4HepEmGammaTrack                  fGammaTrack;
   std::vector<G4HepEmGammaTrack>     fGammaSecondaryTracks;
 
+#ifdef G4HepEm_COUNTERS
+  G4HepEmCounters                    fCounters;
+#endif
+
 };
 
 #endif // G4HepEmTLData_HH
@@ -51,6 +51,9 @@ public:
     fNumIALeft[2] = o.fNumIALeft[2];
 
     fSafety       = o.fSafety;
+    fSafetyOrigin[0] = o.fSafetyOrigin[0];
+    fSafetyOrigin[1] = o.fSafetyOrigin[1];
+    fSafetyOrigin[2] = o.fSafetyOrigin[2];
 
     fID           = o.fID;
     fIDParent     = o.fIDParent;
@@ -125,6 +128,9 @@ public:
     }
     return fLogEKin;
   }
+  // true if the log kinetic energy has already been computed (or set)
+  G4HepEmHostDevice
+  bool      IsLogEKinSet() const { return fLogEKin < 99.0; }
 
   // Charge
   G4HepEmHostDevice
@@ -163,10 +169,27 @@ public:
   G4double* GetNumIALeft()                      {return fNumIALeft; }
 
 
+  // Safety: the last computed (isotropic) safety and the point where it was
+  // computed (its origin) that can be reused, reduced by the distance from the
+  // origin, as a conservative estimate of the safety at an other point.
   G4HepEmHostDevice
   void    SetSafety(G4double s) { fSafety = s; }
   G4HepEmHostDevice
+  void    SetSafety(G4double s, G4double x, G4double y, G4double z) {
+    fSafety          = s;
+    fSafetyOrigin[0] = x;
+    fSafetyOrigin[1] = y;
+    fSafetyOrigin[2] = z;
+  }
+  G4HepEmHostDevice
   G4double  GetSafety() const   { return fSafety; }
+  G4HepEmHostDevice
+  G4double  GetSafety(G4double x, G4double y, G4double z) const {
+    const G4double dx = x - fSafetyOrigin[0];
+    const G4double dy = y - fSafetyOrigin[1];
+    const G4double dz = z - fSafetyOrigin[2];
+    return G4HepEmMax(0.0, fSafety - std::sqrt(dx*dx + dy*dy + dz*dz));
+  }
 
 
   // ID
@@ -226,6 +249,11 @@ public:
     fNumIALeft[1] = -1.0;
     fNumIALeft[2] = -1.0;
 
+    fSafety          = 0.0;
+    fSafetyOrigin[0] = 0.0;
+    fSafetyOrigin[1] = 0.0;
+    fSafetyOrigin[2] = 0.0;
+
     fID           =  -1;
     fIDParent     =  -1;
 
@@ -250,6 +278,7 @@ private:
   G4double   fMFPs[3];       // pair, compton, photo-electric in case of photon
   G4double   fNumIALeft[3];  // ioni, brem, (e+-e- annihilation) in case of e- (e+)
   G4double   fSafety;
+  G4double   fSafetyOrigin[3];
 
   int      fID;
   int      fIDParent;
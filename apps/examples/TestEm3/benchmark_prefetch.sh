@@ -0,0 +1,56 @@
+#!/usr/bin/env bash
+#
+# Runs the `ATLASbar_prefetch.mac` Pb/lAr setup with and without the software
+# prefetching of the G4HepEm e-/e+ tables. It prints the real run time of each
+# repetition, their minimum and mean per physics list and the ratio of the
+# minima, and checks that the layer by layer energy deposits of the two are
+# identical (the prefetching must not change the results).
+#
+# Usage: benchmark_prefetch.sh <path-to-TestEm3-executable> [number-of-repetitions]
+#
+set -e -o pipefail
+
+EXE=${1:?"usage: $0 <path-to-TestEm3-executable> [number-of-repetitions]"}
+NREP=${2:-3}
+MACRO="$(cd "$(dirname "$0")" && pwd)/ATLASbar_prefetch.mac"
+PLISTS=(HepEmTrackingPrefetch HepEmTracking)
+
+TMPDIR=$(mktemp -d)
+trap 'rm -rf "${TMPDIR}"' EXIT
+
+for (( irep=0; irep<NREP; irep++ )); do
+  for plist in "${PLISTS[@]}"; do
+    out="${TMPDIR}/${plist}.${irep}.out"
+    physList=${plist} "${EXE}" -m "${MACRO}" > "${out}"
+    # the real time of the run from the `Time:  User=...s Real=...s Sys=...s` line
+    sed -n 's/.*Time:.*Real=\([0-9.eE+-]*\)s.*/\1/p' "${out}" | tail -n 1 >> "${TMPDIR}/${plist}.times"
+    echo "=== ${plist} (repetition ${irep}): real time = $(tail -n 1 "${TMPDIR}/${plist}.times") [s]"
+  done
+done
+
+# the minimum and the mean of the real times per physics list and the ratio of the minima
+for plist in "${PLISTS[@]}"; do
+  awk -v name="${plist}" 'NR == 1 || $1 < min { min = $1 } { sum += $1 }
+       END { printf(" === %-24s : min = %g [s]  mean = %g [s]  (%d repetitions)\n", name, min, sum/NR, NR) }' \
+      "${TMPDIR}/${plist}.times"
+done
+paste "${TMPDIR}/${PLISTS[0]}.times" "${TMPDIR}/${PLISTS[1]}.times" \
+  | awk 'NR == 1 || $1 < minA { minA = $1 } NR == 1 || $2 < minB { minB = $2 }
+         END { if (minB > 0) printf(" === time with / without prefetching = %g\n", minA/minB) }'
+
+# the energy deposits (of the first repetition) must be identical
+layer_edep() {
+  awk '/Layer by layer mean data/ { inTable = 1; next }
+       inTable && NF == 3 && $1 ~ /^[0-9]+$/ { print $1, $3 }' "$1"
+}
+EDEP_A=$(layer_edep "${TMPDIR}/${PLISTS[0]}.0.out")
+EDEP_B=$(layer_edep "${TMPDIR}/${PLISTS[1]}.0.out")
+if [ -z "${EDEP_A}" ]; then
+  echo " *** no layer by layer energy deposit found in the output"
+  exit 1
+fi
+if [ "${EDEP_A}" != "${EDEP_B}" ]; then
+  echo " *** the layer by layer energy deposits with and without prefetching differ"
+  exit 1
+fi
+echo " === the layer by layer energy deposits with and without prefetching are identical"
@@ -0,0 +1,68 @@
+#!/usr/bin/env bash
+#
+# Runs a TestEm3 macro, that takes the physics list from the `physList`
+# environment variable (e.g. `ATLASbar_compare.mac`), with two physics lists
+# and compares the layer by layer mean energy deposits reported at the end of
+# the two runs. They agree if in each layer
+#
+#   |edep_A - edep_B| <= REL_TOL * max(edep_A, edep_B) + ABS_TOL * max_edep_A
+#
+# (where `max_edep_A` is the largest layer energy deposit of the first run) and
+# the total energy deposits agree within REL_TOL_TOTAL (relative). All the
+# tolerances set to 0 (default) require identical energy deposits.
+#
+# Usage: compare_layer_edep.sh <path-to-TestEm3-executable> <macro> <physList-A> <physList-B> \
+#                              [REL_TOL ABS_TOL REL_TOL_TOTAL]
+#
+set -e -o pipefail
+
+USAGE="usage: $0 <path-to-TestEm3-executable> <macro> <physList-A> <physList-B> [REL_TOL ABS_TOL REL_TOL_TOTAL]"
+EXE=${1:?"${USAGE}"}
+MACRO=${2:?"${USAGE}"}
+PLIST_A=${3:?"${USAGE}"}
+PLIST_B=${4:?"${USAGE}"}
+REL_TOL=${5:-0}
+ABS_TOL=${6:-0}
+REL_TOL_TOTAL=${7:-0}
+
+# prints the `layer-index edep` pairs of the `Layer by layer mean data` table
+run_layer_edep() {
+  physList=$1 "${EXE}" -m "${MACRO}" \
+    | awk '/Layer by layer mean data/ { inTable = 1; next }
+           inTable && NF == 3 && $1 ~ /^[0-9]+$/ { print $1, $3 }'
+}
+
+EDEP_A=$(run_layer_edep "${PLIST_A}")
+EDEP_B=$(run_layer_edep "${PLIST_B}")
+
+paste -d ' ' <(echo "${EDEP_A}") <(echo "${EDEP_B}") \
+  | awk -v relTol="${REL_TOL}" -v absTol="${ABS_TOL}" -v relTolTotal="${REL_TOL_TOTAL}" \
+        -v nameA="${PLIST_A}" -v nameB="${PLIST_B}" '
+    NF > 0 {
+      n++
+      layerA[n] = $1; edepA[n] = $2; layerB[n] = $3; edepB[n] = $4
+      if ($2 + 0 > maxA) maxA = $2 + 0
+      totalA += $2; totalB += $4
+    }
+    END {
+      if (n == 0) {
+        print " *** no layer by layer energy deposit found in the output"
+        exit 1
+      }
+      numFailed = 0
+      for (i = 1; i <= n; ++i) {
+        diff = edepA[i] - edepB[i]; if (diff < 0) diff = -diff
+        larger = edepA[i] + 0 > edepB[i] + 0 ? edepA[i] : edepB[i]
+        if (layerA[i] != layerB[i] || diff > relTol * larger + absTol * maxA) {
+          printf("  layer %s: %s = %s [MeV] %s = %s [MeV]\n", layerA[i], nameA, edepA[i], nameB, edepB[i])
+          ++numFailed
+        }
+      }
+      diff = totalA - totalB; if (diff < 0) diff = -diff
+      if (diff > relTolTotal * totalA) {
+        printf("  total: %s = %g [MeV] %s = %g [MeV]\n", nameA, totalA, nameB, totalB)
+        ++numFailed
+      }
+      printf(" === %d layers compared (%s v.s. %s): %d deviation(s)\n", n, nameA, nameB, numFailed)
+      exit numFailed > 0
+    }'
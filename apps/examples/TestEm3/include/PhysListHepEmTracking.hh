@@ -9,13 +9,25 @@
 class PhysListHepEmTracking : public G4VPhysicsConstructor
 {
   public: 
-     PhysListHepEmTracking(const G4String& name = "HepEmTracking");
+     PhysListHepEmTracking(const G4String& name = "HepEmTracking", G4bool useFloat32Tables = false,
+                           G4bool prefetchTables = false, G4bool multipleStepsInSafety = false,
+                           const G4String& woodcockRegion = "");
     ~PhysListHepEmTracking();
 
   public: 
     void ConstructParticle() override {}
 
     void ConstructProcess() override;
+
+  private:
+    // use the single precision copies of the G4HepEm run-time tables
+    G4bool fUseFloat32Tables;
+    // issue software prefetch hints for the e-/e+ tables in the stepping loop
+    G4bool fPrefetchTables;
+    // do the MSC limited e-/e+ sub-steps inside the safety without navigation
+    G4bool fMultipleStepsInSafety;
+    // name of the region with Woodcock tracking of gammas (none if empty)
+    G4String fWoodcockRegion;
 };
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
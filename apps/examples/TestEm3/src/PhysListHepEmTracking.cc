@@ -10,8 +10,12 @@
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
-PhysListHepEmTracking::PhysListHepEmTracking(const G4String& name)
-   :  G4VPhysicsConstructor(name)
+PhysListHepEmTracking::PhysListHepEmTracking(const G4String& name, G4bool useFloat32Tables,
+                                             G4bool prefetchTables, G4bool multipleStepsInSafety,
+                                             const G4String& woodcockRegion)
+   :  G4VPhysicsConstructor(name), fUseFloat32Tables(useFloat32Tables),
+      fPrefetchTables(prefetchTables), fMultipleStepsInSafety(multipleStepsInSafety),
+      fWoodcockRegion(woodcockRegion)
 {
   G4EmParameters* param = G4EmParameters::Instance();
   param->SetDefaults();
@@ -30,6 +34,12 @@ void PhysListHepEmTracking::ConstructProcess()
 {
   // Register custom tracking manager for e-/e+ and gammas.
   auto* trackingManager = new G4HepEmTrackingManager;
+  trackingManager->SetUseFloat32Tables(fUseFloat32Tables);
+  trackingManager->SetPrefetchTables(fPrefetchTables);
+  trackingManager->SetMultipleStepsInSafety(fMultipleStepsInSafety);
+  if (!fWoodcockRegion.empty()) {
+    trackingManager->AddWoodcockTrackingRegion(fWoodcockRegion);
+  }
 
   G4Electron::Definition()->SetTrackingManager(trackingManager);
   G4Positron::Definition()->SetTrackingManager(trackingManager);
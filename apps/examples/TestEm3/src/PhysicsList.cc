@@ -137,7 +137,7 @@ void PhysicsList::ConstructProcess()
   // Electromagnetic Physics List
   fEmPhysicsList->ConstructProcess();
   // Other processes but only if not HepEm physics list is used
-  if (fEmName!="HepEm" && fEmName!="HepEmTracking" && fEmName!="G4Em" && fEmName!="G4EmTracking") {
+  if (fEmName!="HepEm" && fEmName!="HepEmTracking" && fEmName!="HepEmTrackingFloat32" && fEmName!="HepEmTrackingPrefetch" && fEmName!="HepEmTrackingSafety" && fEmName!="HepEmTrackingWoodcock" && fEmName!="G4Em" && fEmName!="G4EmTracking") {
     fDecayPhysics = new G4DecayPhysics(1);
     fDecayPhysics->ConstructProcess();
     AddStepMax();
@@ -172,6 +172,31 @@ void PhysicsList::AddPhysicsList(const G4String& name)
     fEmName = name;
     delete fEmPhysicsList;
     fEmPhysicsList = new PhysListHepEmTracking();
+
+  } else if (name == "HepEmTrackingFloat32") {
+
+    fEmName = name;
+    delete fEmPhysicsList;
+    fEmPhysicsList = new PhysListHepEmTracking(name, true);
+
+  } else if (name == "HepEmTrackingPrefetch") {
+
+    fEmName = name;
+    delete fEmPhysicsList;
+    fEmPhysicsList = new PhysListHepEmTracking(name, false, true);
+
+  } else if (name == "HepEmTrackingSafety") {
+
+    fEmName = name;
+    delete fEmPhysicsList;
+    fEmPhysicsList = new PhysListHepEmTracking(name, false, false, true);
+
+  } else if (name == "HepEmTrackingWoodcock") {
+
+    fEmName = name;
+    delete fEmPhysicsList;
+    // Woodcock tracking of gammas in the whole (world) volume
+    fEmPhysicsList = new PhysListHepEmTracking(name, false, false, false, "DefaultRegionForTheWorld");
 #endif
 
   } else if (name == "G4Em") {
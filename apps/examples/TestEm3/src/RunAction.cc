@@ -43,6 +43,8 @@
 #include "Randomize.hh"
 
 #include "G4ProductionCutsTable.hh"
+#include "G4HepEmRunManager.hh"
+
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
 RunAction::RunAction(DetectorConstruction* det, PrimaryGeneratorAction* prim)
@@ -115,6 +117,13 @@ void RunAction::EndOfRunAction(const G4Run*)
     G4cout << "   Time:  "  << *fTimer << G4endl;
     G4cout << "  ======================================================" << G4endl;
     delete fTimer;
+#ifdef G4HepEm_COUNTERS
+    // the G4HepEm run-time counters (if G4HepEm is used)
+    if (G4HepEmRunManager* hepEmRM = G4HepEmRunManager::GetMasterRunManager()) {
+      hepEmRM->ReportCounters();
+      hepEmRM->ResetCounters();
+    }
+#endif
     if (!fIsPerformance) {
       fRun->EndOfRun();
     } else {
@@ -0,0 +1,154 @@
+// local (and TestUtils) includes
+#include "TestUtils/SamplingComparison.hh"
+
+// G4 includes
+#include "globals.hh"
+#include "G4SystemOfUnits.hh"
+
+// G4HepEm includes
+#include "G4HepEmRunManager.hh"
+#include "G4HepEmRandomEngine.hh"
+#include "G4HepEmData.hh"
+#include "G4HepEmMatCutData.hh"
+#include "G4HepEmMaterialData.hh"
+#include "G4HepEmElementData.hh"
+#include "G4HepEmElectronData.hh"
+#include "G4HepEmConstants.hh"
+
+#include "G4HepEmElectronInteractionBrem.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// Compares the mean of the emitted photon energy and of its logarithm of the
+// relativistic bremsstrahlung model sampled with the tabulated rejection
+// envelopes (G4HepEmParameters::fUseRBBremEnvelopeTables) to those sampled with
+// the analytic rejection (i.e. when the envelopes are not available) at a set
+// of primary kinetic energies for some of the material - cuts couples. It also
+// checks on a fine grid, and at each sample, that the rejection function does
+// not exceed the envelope. Both samplings start from fixed seeds (see
+// SamplingComparison.hh) so the test is reproducible. The timing of the two
+// samplings is done by benchmarkBremRBEnvelope.
+
+// Both samplings are exact (as long as the envelope is not exceeded, which is
+// also checked) so the means can differ only statistically: the difference must
+// be within kNumSigma standard deviations of the difference of the sample means.
+const G4double kNumSigma = 5.0;
+// the fixed seeds of the analytic and of the envelope rejection samplings
+const long kSeedAnalytic = 12345;
+const long kSeedEnvelope = 67890;
+
+// the maximum of the ratio of the rejection function to the envelope on a fine
+// grid of the transformed variable
+G4double CheckEnvelope(const G4HepEmData* hepEmData, const G4HepEmElectronData* elData, int imc, G4double ekin) {
+  const G4HepEmMCCData& mccData = hepEmData->fTheMatCutData->fMatCutData[imc];
+  const G4HepEmMatData& matData = hepEmData->fTheMaterialData->fMaterialData[mccData.fHepEmMatIndex];
+  const G4double lekin = std::log(ekin);
+  const int iEkin = (int)((lekin - elData->fBremRBEnvLogMinEkin)*elData->fBremRBEnvEILDelta);
+  if (iEkin < 0 || iEkin > elData->fBremRBEnvNumEkin-2) {
+    return 0.0;
+  }
+  const int numBins = elData->fBremRBEnvNumBins;
+  const G4double densityFactor = kMigdalConst * matData.fElectronDensity;
+  const G4double     lpmEnergy = kLPMconstant * matData.fRadiationLength;
+  const G4double thePrimTotalE = ekin + kElectronMassC2;
+  const G4double   densityCorr = densityFactor * thePrimTotalE * thePrimTotalE;
+  const bool       isLPMActive = thePrimTotalE > std::sqrt(densityFactor) * lpmEnergy;
+  const G4double     theGamCut = mccData.fSecGamProdCutE;
+  const G4double          xmin = std::log(theGamCut*theGamCut + densityCorr);
+  const G4double        xrange = std::log(ekin*ekin + densityCorr) - xmin;
+  G4double maxRatio = 0.0;
+  for (int ielem = 0; ielem < matData.fNumOfElement; ++ielem) {
+    const int iZet = matData.fElementVect[ielem];
+    const G4HepEmElemData& elemData = hepEmData->fTheElementData->fElementData[std::min(iZet, hepEmData->fTheElementData->fMaxZet)];
+    const G4double zFactor1 = elemData.fZFactor1;
+    const G4double zFactor2 = (1.+1./iZet)/12.;
+    const G4double* env0 = &(elData->fBremRBEnvData[elData->fBremRBEnvStartIndexPerMatCut[imc]
+                                                    + (ielem*elData->fBremRBEnvNumEkin + iEkin)*numBins]);
+    const G4double* env1 = env0 + numBins;
+    const int numPoints = 1000;
+    for (int i = 0; i < numPoints; ++i) {
+      const G4double u  = (i + 0.5)/numPoints;
+      const int      ib = std::min(numBins-1, (int)(u*numBins));
+      const G4double eGamma = std::sqrt(std::max(std::exp(xmin + u*xrange) - densityCorr, 0.0));
+      const G4double val = G4HepEmElectronInteractionBrem::ComputeDXSectionRB(eGamma, thePrimTotalE, lpmEnergy,
+                             densityCorr, isLPMActive, iZet, elemData, zFactor1, zFactor2)/(zFactor1 + zFactor2);
+      maxRatio = std::max(maxRatio, val/std::max(env0[ib], env1[ib]));
+    }
+  }
+  return maxRatio;
+}
+
+bool TestBremRBEnvelope(G4HepEmData* hepEmData, bool iselectron, G4HepEmRandomEngine* rnge) {
+  G4HepEmElectronData* elData = iselectron ? hepEmData->fTheElectronData : hepEmData->fThePositronData;
+  if (elData->fBremRBEnvData == nullptr) {
+    std::cerr << " *** relativistic brem rejection envelopes were not built" << std::endl;
+    return false;
+  }
+  const int numSamples = 100000;
+  const G4double theEkins[] = {2.0*GeV, 30.0*GeV, 1.0*TeV, 50.0*TeV};
+  const int numMatCuts = hepEmData->fTheMatCutData->fNumMatCutData;
+  G4double maxDev    = 0.0;
+  G4double maxRatio  = 0.0;
+  int      numViol   = 0;
+  G4double* envData  = elData->fBremRBEnvData;
+  for (int imc = 0; imc < numMatCuts; imc += 20) {
+    for (G4double ekin : theEkins) {
+      const G4double lekin = std::log(ekin);
+      // the analytic rejection (no envelopes)
+      elData->fBremRBEnvData = nullptr;
+      SampleMoments anal, logAnal;
+      SetSamplingSeed(rnge, kSeedAnalytic);
+      for (int i = 0; i < numSamples; ++i) {
+        const G4double eGamma = G4HepEmElectronInteractionBrem::SampleETransferRB(hepEmData, ekin, lekin, imc, rnge, iselectron);
+        anal.Add(eGamma/ekin);
+        logAnal.Add(std::log(eGamma/ekin));
+      }
+      // the tabulated envelopes
+      elData->fBremRBEnvData = envData;
+      SampleMoments env, logEnv;
+      SetSamplingSeed(rnge, kSeedEnvelope);
+      for (int i = 0; i < numSamples; ++i) {
+        const G4double eGamma = G4HepEmElectronInteractionBrem::SampleETransferRB(hepEmData, ekin, lekin, imc, rnge, iselectron,
+                                                                                  nullptr, &numViol);
+        env.Add(eGamma/ekin);
+        logEnv.Add(std::log(eGamma/ekin));
+      }
+      const G4double dev = std::max(MeanDeviation(env, anal, 0.0), MeanDeviation(logEnv, logAnal, 0.0));
+      if (dev > kNumSigma) {
+        std::cout << "   deviation = " << dev << " sigma at imc = " << imc << " ekin = " << ekin/GeV
+                  << " [GeV] : <k/E> analytic = " << anal.Mean() << " envelope = " << env.Mean()
+                  << " <ln(k/E)> analytic = " << logAnal.Mean() << " envelope = " << logEnv.Mean() << std::endl;
+      }
+      maxDev   = std::max(maxDev, dev);
+      maxRatio = std::max(maxRatio, CheckEnvelope(hepEmData, elData, imc, ekin));
+    }
+  }
+  std::cout << "   <k/E>, <ln(k/E)> : max. deviation = " << maxDev << " sigma"
+            << (maxDev < kNumSigma ? "  OK" : "  FAILED") << std::endl;
+  std::cout << "   max. rejection function / envelope = " << maxRatio
+            << (maxRatio <= 1.0 ? "  OK" : "  FAILED") << std::endl;
+  std::cout << "   samples exceeding the envelope = " << numViol
+            << (numViol == 0 ? "  OK" : "  FAILED") << std::endl;
+  return maxDev < kNumSigma && maxRatio <= 1.0 && numViol == 0;
+}
+
+int main() {
+  // --- Initialise G4HepEm for e- and e+ with building the envelopes (with all
+  //     pre-defined NIST materials).
+  G4HepEmRunManager* runMgr = new G4HepEmRunManager ( true );
+  runMgr->SetUseRBBremEnvelopeTables(true);
+  G4HepEmRandomEngine* rnge = InitSamplingComparison(runMgr, {0, 1});
+  G4HepEmData* hepEmData = runMgr->GetHepEmData();
+  //
+  std::cout << " === Relativistic brem envelopes v.s. analytic rejection: e-" << std::endl;
+  bool isOK = TestBremRBEnvelope(hepEmData, true, rnge);
+  std::cout << " === Relativistic brem envelopes v.s. analytic rejection: e+" << std::endl;
+  isOK = TestBremRBEnvelope(hepEmData, false, rnge) && isOK;
+  if (!isOK) {
+    return 1;
+  }
+  std::cout << " === Relativistic brem envelopes Test: PASSING \n" << std::endl;
+  return 0;
+}
@@ -0,0 +1,116 @@
+// local (and TestUtils) includes
+#include "TestUtils/SamplingComparison.hh"
+
+// G4 includes
+#include "globals.hh"
+#include "G4SystemOfUnits.hh"
+
+// G4HepEm includes
+#include "G4HepEmRunManager.hh"
+#include "G4HepEmRandomEngine.hh"
+#include "G4HepEmData.hh"
+#include "G4HepEmGammaData.hh"
+#include "G4HepEmConstants.hh"
+
+#include "G4HepEmGammaInteractionCompton.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// Compares the reduced post interaction photon energy eps in Compton scattering
+// sampled from the Klein-Nishina inverse CDF tables
+// (G4HepEmParameters::fUseCompInvCDFTables) to that sampled by rejection at a
+// set of primary photon energies (both on and between the Compton energy grid
+// points): the means of eps and of the photon cos(theta) as well as the
+// chi2/ndf of the two histograms in t = ln(eps)/ln(eps_0) are checked. Both
+// samplings start from fixed seeds (see SamplingComparison.hh) so the test is
+// reproducible. The timing of the two samplings is done by
+// benchmarkCompInvCDFTables.
+
+// The accepted difference of the means: the tables (128 points in the CDF,
+// linear interpolation in the CDF and in ln(E)) bias the means by up to
+// kSysToleranceMean (absolute). Beyond this, the difference must be within
+// kNumSigma standard deviations of the difference of the two sample means.
+const G4double kSysToleranceMean = 0.002;
+const G4double kNumSigma         = 5.0;
+// The accepted chi2/ndf of the two histograms: for two samples of the same
+// distribution P(chi2/ndf > 3) < 1E-8 (ndf ~ 39), while the table bias alone
+// gave chi2/ndf <= 1.1 with 10 times more samples than here.
+const G4double kToleranceChi2 = 3.0;
+// number of bins of the t histograms
+const int kNumBins = 40;
+// the fixed seeds of the rejection and of the tabulated samplings
+const long kSeedRejection = 12345;
+const long kSeedTable     = 67890;
+
+bool TestCompInvCDFTables(const G4HepEmGammaData* gmData, G4HepEmRandomEngine* rnge) {
+  if (gmData->fCompInvCDFData == nullptr) {
+    std::cerr << " *** Compton inverse CDF tables were not built" << std::endl;
+    return false;
+  }
+  const int numSamples = 100000;
+  const G4double theEkins[] = {150.0*eV, 1.0*keV, 12.3*keV, 100.0*keV, 511.0*keV, 1.7*MeV, 33.0*MeV, 1.0*GeV,
+                               100.0*GeV, 70.0*TeV};
+  const G4double theOrgDir[3] = {0.0, 0.0, 1.0};
+  G4double theDir[3];
+  G4double maxDevMean = 0.0;
+  G4double maxChi2    = 0.0;
+  for (G4double ekin : theEkins) {
+    const G4double lekin = std::log(ekin);
+    const G4double lEps0 = -std::log(1.0 + 2.0*ekin*kInvElectronMassC2);
+    G4double histRej[kNumBins]  = {0.0};
+    G4double histTabl[kNumBins] = {0.0};
+    // the rejection sampling
+    SampleMoments epsRej, costRej;
+    SetSamplingSeed(rnge, kSeedRejection);
+    for (int i = 0; i < numSamples; ++i) {
+      const G4double eps = G4HepEmGammaInteractionCompton::SamplePhotonEnergyAndDirection(ekin, theDir, theOrgDir, rnge)/ekin;
+      epsRej.Add(eps);
+      costRej.Add(theDir[2]);
+      const int ib = std::min(kNumBins - 1, std::max(0, (int)(std::log(eps)/lEps0*kNumBins)));
+      histRej[ib] += 1.0;
+    }
+    // the tabulated inverse CDF
+    SampleMoments epsTabl, costTabl;
+    SetSamplingSeed(rnge, kSeedTable);
+    for (int i = 0; i < numSamples; ++i) {
+      const G4double eps = G4HepEmGammaInteractionCompton::SamplePhotonEnergyAndDirectionTable(gmData, ekin, lekin, theDir,
+                                                                                              theOrgDir, rnge)/ekin;
+      epsTabl.Add(eps);
+      costTabl.Add(theDir[2]);
+      const int ib = std::min(kNumBins - 1, std::max(0, (int)(std::log(eps)/lEps0*kNumBins)));
+      histTabl[ib] += 1.0;
+    }
+    const G4double chi2    = Chi2PerNDF(histRej, histTabl, kNumBins);
+    const G4double devMean = std::max(MeanDeviation(epsTabl, epsRej, kSysToleranceMean),
+                                      MeanDeviation(costTabl, costRej, kSysToleranceMean));
+    if (devMean > kNumSigma || chi2 > kToleranceChi2) {
+      std::cout << "   deviation at ekin = " << ekin/MeV << " [MeV] : <eps> rejection = " << epsRej.Mean()
+                << " tabulated = " << epsTabl.Mean() << " <cos(theta)> rejection = " << costRej.Mean()
+                << " tabulated = " << costTabl.Mean() << " (" << devMean << " sigma) chi2/ndf = " << chi2 << std::endl;
+    }
+    maxDevMean = std::max(maxDevMean, devMean);
+    maxChi2    = std::max(maxChi2, chi2);
+  }
+  const bool isOK = maxDevMean < kNumSigma && maxChi2 < kToleranceChi2;
+  std::cout << "   max. deviation of the means = " << maxDevMean << " sigma (beyond " << kSysToleranceMean
+            << ") max. chi2/ndf = " << maxChi2 << (isOK ? "  OK" : "  FAILED") << std::endl;
+  return isOK;
+}
+
+int main() {
+  // --- Initialise G4HepEm for gamma with the Compton inverse CDF tables (with
+  //     all pre-defined NIST materials).
+  G4HepEmRunManager* runMgr = new G4HepEmRunManager ( true );
+  runMgr->SetUseCompInvCDFTables(true);
+  G4HepEmRandomEngine* rnge = InitSamplingComparison(runMgr, {2});
+  const G4HepEmData* hepEmData = runMgr->GetHepEmData();
+  //
+  std::cout << " === Klein-Nishina inverse CDF tables v.s. rejection sampling: gamma" << std::endl;
+  if (!TestCompInvCDFTables(hepEmData->fTheGammaData, rnge)) {
+    return 1;
+  }
+  std::cout << " === Compton inverse CDF tables Test: PASSING \n" << std::endl;
+  return 0;
+}
@@ -0,0 +1,226 @@
+// local (and TestUtils) includes
+#include "TestUtils/G4SetUp.hh"
+
+// G4 includes
+#include "globals.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4MaterialCutsCouple.hh"
+#include "Randomize.hh"
+
+// G4HepEm includes
+#include "G4HepEmRunManager.hh"
+#include "G4HepEmRandomEngine.hh"
+#include "G4HepEmData.hh"
+#include "G4HepEmMatCutData.hh"
+#include "G4HepEmParameters.hh"
+#include "G4HepEmTLData.hh"
+#include "G4HepEmElectronTrack.hh"
+#include "G4HepEmGammaTrack.hh"
+#include "G4HepEmElectronManager.hh"
+#include "G4HepEmElectronPipeline.hh"
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// Compares the stage based e-/e+ stepping of G4HepEmElectronPipeline to the
+// single track G4HepEmElectronManager::HowFar and ::Perform: a mixed batch of
+// e- and e+ primaries (in a given material, at a set of kinetic energies) makes
+// one step with both and the means of the post-step kinetic energy, the energy
+// deposit, the number of the secondary e-/e+ and gamma tracks and their kinetic
+// energy (per primary) are compared. The two consume the random numbers in a
+// different order so only a statistical agreement is expected: the means must
+// agree within `kToleranceSigma` standard errors. The batches are large enough
+// to make the secondary track buffers grow while the pipeline runs.
+// The software prefetching of the pipeline must not change the results: the
+// same batch stepped from the same seed with different prefetch distances
+// (G4HepEmElectronPipeline::SetPrefetchDistance) must give identical results.
+
+// the accepted deviation of the means in units of their standard error
+const G4double kToleranceSigma = 5.0;
+// number of the observables per primary
+const int kNumObs = 6;
+const char* kObsNames[kNumObs] = {"post-step ekin", "edep", "#sec. e-/e+", "#sec. gamma", "sec. e-/e+ ekin", "sec. gamma ekin"};
+
+struct Stat {
+  G4double fSum[kNumObs]  = {0.0};
+  G4double fSum2[kNumObs] = {0.0};
+  long     fNum           = 0;
+  void Add(const G4double* obs) {
+    for (int io = 0; io < kNumObs; ++io) {
+      fSum[io]  += obs[io];
+      fSum2[io] += obs[io]*obs[io];
+    }
+    ++fNum;
+  }
+  G4double Mean(int io) const { return fSum[io]/fNum; }
+  G4double Var(int io) const {
+    const G4double var = fSum2[io]/fNum - Mean(io)*Mean(io);
+    return var > 0.0 ? var : 0.0;
+  }
+};
+
+// the i-th primary: e- and e+ alternate
+void InitPrimary(G4HepEmElectronTrack* elTrack, int i, int hepEmIMC, G4double ekin) {
+  elTrack->ReSet();
+  G4HepEmTrack* theTrack = elTrack->GetTrack();
+  theTrack->SetCharge(i % 2 == 0 ? -1.0 : 1.0);
+  theTrack->SetEKin(ekin, std::log(ekin));
+  theTrack->SetMCIndex(hepEmIMC);
+  theTrack->SetID(i);
+  theTrack->SetOnBoundary(false);
+  G4double* theDir = theTrack->GetDirection();
+  theDir[0] = 0.0;
+  theDir[1] = 0.0;
+  theDir[2] = 1.0;
+}
+
+// adds the secondaries stored in `tlData` to the observables of their primaries
+void AddSecondaries(G4HepEmTLData* tlData, std::vector<G4double>& obs, int idOffset) {
+  for (std::size_t is = 0; is < tlData->GetNumSecondaryElectronTrack(); ++is) {
+    const G4HepEmTrack* theSec = tlData->GetSecondaryElectronTrack(is)->GetTrack();
+    G4double* theObs = &obs[kNumObs*(theSec->GetParentID() - idOffset)];
+    theObs[2] += 1.0;
+    theObs[4] += theSec->GetEKin();
+  }
+  for (std::size_t is = 0; is < tlData->GetNumSecondaryGammaTrack(); ++is) {
+    const G4HepEmTrack* theSec = tlData->GetSecondaryGammaTrack(is)->GetTrack();
+    G4double* theObs = &obs[kNumObs*(theSec->GetParentID() - idOffset)];
+    theObs[3] += 1.0;
+    theObs[5] += theSec->GetEKin();
+  }
+  tlData->ResetNumSecondaryElectronTrack();
+  tlData->ResetNumSecondaryGammaTrack();
+}
+
+bool TestElectronPipeline(G4HepEmData* hepEmData, G4HepEmParameters* hepEmPars, G4HepEmTLData* tlData, int hepEmIMC,
+                          G4double ekin) {
+  const int numBatches = 40;
+  const int batchSize  = 512;
+  G4HepEmElectronPipeline pipeline;
+  std::vector<G4HepEmElectronTrack> tracks(batchSize);
+  std::vector<G4double> obs(kNumObs*batchSize);
+  Stat statSingle, statPipeline;
+  for (int ib = 0; ib < numBatches; ++ib) {
+    // the single track stepping
+    std::fill(obs.begin(), obs.end(), 0.0);
+    G4HepEmElectronTrack* thePrimary = tlData->GetPrimaryElectronTrack();
+    for (int i = 0; i < batchSize; ++i) {
+      InitPrimary(thePrimary, i, hepEmIMC, ekin);
+      G4HepEmElectronManager::HowFar(hepEmData, hepEmPars, tlData);
+      G4HepEmElectronManager::Perform(hepEmData, hepEmPars, tlData);
+      obs[kNumObs*i + 0] = thePrimary->GetTrack()->GetEKin();
+      obs[kNumObs*i + 1] = thePrimary->GetTrack()->GetEnergyDeposit();
+      AddSecondaries(tlData, obs, 0);
+    }
+    for (int i = 0; i < batchSize; ++i) {
+      statSingle.Add(&obs[kNumObs*i]);
+    }
+    // the stage based stepping of the same batch
+    std::fill(obs.begin(), obs.end(), 0.0);
+    for (int i = 0; i < batchSize; ++i) {
+      InitPrimary(&tracks[i], i, hepEmIMC, ekin);
+    }
+    pipeline.HowFar(hepEmData, hepEmPars, tracks.data(), batchSize, tlData);
+    pipeline.Perform(hepEmData, hepEmPars, tracks.data(), batchSize, tlData);
+    for (int i = 0; i < batchSize; ++i) {
+      obs[kNumObs*i + 0] = tracks[i].GetTrack()->GetEKin();
+      obs[kNumObs*i + 1] = tracks[i].GetTrack()->GetEnergyDeposit();
+    }
+    AddSecondaries(tlData, obs, 0);
+    for (int i = 0; i < batchSize; ++i) {
+      statPipeline.Add(&obs[kNumObs*i]);
+    }
+  }
+  bool isOK = true;
+  for (int io = 0; io < kNumObs; ++io) {
+    const G4double sigma = std::sqrt((statSingle.Var(io) + statPipeline.Var(io))/statSingle.fNum);
+    const G4double dev   = std::abs(statSingle.Mean(io) - statPipeline.Mean(io));
+    if (dev > kToleranceSigma*sigma + 1.0E-12*std::abs(statSingle.Mean(io))) {
+      std::cout << "   deviation at ekin = " << ekin/MeV << " [MeV] in <" << kObsNames[io] << "> : single track = "
+                << statSingle.Mean(io) << " pipeline = " << statPipeline.Mean(io) << " (sigma = " << sigma << ")"
+                << std::endl;
+      isOK = false;
+    }
+  }
+  return isOK;
+}
+
+// the per primary observables (and their post-step direction) of one step of a
+// batch made by the pipeline with the given prefetch distance from the given seed
+std::vector<G4double> RunPipeline(G4HepEmData* hepEmData, G4HepEmParameters* hepEmPars, G4HepEmTLData* tlData,
+                                  int hepEmIMC, G4double ekin, int prefetchDistance, long seed) {
+  const int batchSize = 512;
+  G4HepEmElectronPipeline pipeline;
+  pipeline.SetPrefetchDistance(prefetchDistance);
+  std::vector<G4HepEmElectronTrack> tracks(batchSize);
+  std::vector<G4double> obs((kNumObs+3)*batchSize, 0.0);
+  for (int i = 0; i < batchSize; ++i) {
+    InitPrimary(&tracks[i], i, hepEmIMC, ekin);
+  }
+  G4Random::setTheSeed(seed);
+  tlData->GetRNGEngine()->DiscardGauss();
+  pipeline.HowFar(hepEmData, hepEmPars, tracks.data(), batchSize, tlData);
+  pipeline.Perform(hepEmData, hepEmPars, tracks.data(), batchSize, tlData);
+  for (int i = 0; i < batchSize; ++i) {
+    G4HepEmTrack* theTrack = tracks[i].GetTrack();
+    obs[kNumObs*i + 0] = theTrack->GetEKin();
+    obs[kNumObs*i + 1] = theTrack->GetEnergyDeposit();
+    const G4double* theDir = theTrack->GetDirection();
+    obs[kNumObs*batchSize + 3*i + 0] = theDir[0];
+    obs[kNumObs*batchSize + 3*i + 1] = theDir[1];
+    obs[kNumObs*batchSize + 3*i + 2] = theDir[2];
+  }
+  AddSecondaries(tlData, obs, 0);
+  return obs;
+}
+
+bool TestPrefetchDistance(G4HepEmData* hepEmData, G4HepEmParameters* hepEmPars, G4HepEmTLData* tlData, int hepEmIMC,
+                          G4double ekin) {
+  const long seed = 7654321;
+  const std::vector<G4double> obsNoPrefetch = RunPipeline(hepEmData, hepEmPars, tlData, hepEmIMC, ekin, 0, seed);
+  bool isOK = true;
+  for (int prefetchDistance : {1, 4, 16}) {
+    const std::vector<G4double> obs = RunPipeline(hepEmData, hepEmPars, tlData, hepEmIMC, ekin, prefetchDistance, seed);
+    if (obs != obsNoPrefetch) {
+      std::cout << "   results differ at ekin = " << ekin/MeV << " [MeV] with prefetch distance = "
+                << prefetchDistance << " and without prefetching" << std::endl;
+      isOK = false;
+    }
+  }
+  return isOK;
+}
+
+int main() {
+  // --- Set up a fake G4 geometry with a single material to produce the
+  //     G4MaterialCutsCouple object.
+  const G4double secProdThreshold = 0.7*mm;
+  const G4MaterialCutsCouple* couple = FakeG4Setup (secProdThreshold, "G4_PbWO4", 0);
+  //
+  // --- Initialise G4HepEm for e- and e+ with a fixed seed.
+  G4Random::setTheSeed(1234567);
+  G4HepEmRunManager* runMgr = new G4HepEmRunManager ( true );
+  G4HepEmRandomEngine* rnge = new G4HepEmRandomEngine(G4Random::getTheEngine());
+  runMgr->Initialize ( rnge, 0 );
+  runMgr->Initialize ( rnge, 1 );
+  G4HepEmData* hepEmData = runMgr->GetHepEmData();
+  G4HepEmParameters* hepEmPars = runMgr->GetHepEmParameters();
+  G4HepEmTLData* tlData = runMgr->GetTheTLData();
+  const int hepEmIMC = hepEmData->fTheMatCutData->fG4MCIndexToHepEmMCIndex[couple->GetIndex()];
+  //
+  std::cout << " === Stage based pipeline v.s. single track stepping: e-/e+" << std::endl;
+  const G4double theEkins[] = {0.5*MeV, 10.0*MeV, 1.0*GeV, 50.0*GeV};
+  bool isOK = true;
+  for (G4double ekin : theEkins) {
+    isOK = TestElectronPipeline(hepEmData, hepEmPars, tlData, hepEmIMC, ekin) && isOK;
+  }
+  std::cout << " === Stage based pipeline with v.s. without prefetching: e-/e+" << std::endl;
+  for (G4double ekin : theEkins) {
+    isOK = TestPrefetchDistance(hepEmData, hepEmPars, tlData, hepEmIMC, ekin) && isOK;
+  }
+  if (!isOK) {
+    return 1;
+  }
+  std::cout << " === Electron pipeline Test: PASSING \n" << std::endl;
+  return 0;
+}
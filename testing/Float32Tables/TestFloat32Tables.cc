@@ -0,0 +1,205 @@
+// local (and TestUtils) includes
+#include "TestUtils/G4SetUp.hh"
+
+// G4 includes
+#include "globals.hh"
+#include "G4SystemOfUnits.hh"
+#include "Randomize.hh"
+
+// G4HepEm includes
+#include "G4HepEmRunManager.hh"
+#include "G4HepEmRandomEngine.hh"
+#include "G4HepEmParameters.hh"
+#include "G4HepEmData.hh"
+#include "G4HepEmMatCutData.hh"
+#include "G4HepEmMaterialData.hh"
+#include "G4HepEmElectronData.hh"
+#include "G4HepEmGammaData.hh"
+
+#include "G4HepEmElectronManager.hh"
+#include "G4HepEmGammaManager.hh"
+#include "G4HepEmElectronInteractionBrem.hh"
+#include "G4HepEmGammaInteractionConversion.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Compares the run-time observables (range, dedx, inverse range, restricted and
+// transport macroscopic cross sections, gamma macroscopic cross sections and
+// the sampled target elements) obtained with the single precision copies of the
+// tables (G4HepEmParameters::fUseFloat32Tables) to those obtained with the
+// original double precision tables.
+
+// the accepted relative deviation (relative to the maximum of the curve)
+const G4double kTolerance = 1.0E-5;
+// the accepted fraction of different target element indices
+const G4double kElemTolerance = 1.0E-4;
+
+struct MaxDeviation {
+  std::string fName;
+  G4double    fMaxDev = 0.0;
+  void Add(const std::vector<G4double>& vD, const std::vector<G4double>& vF) {
+    G4double maxVal = 0.0;
+    for (auto v : vD) { maxVal = std::max(maxVal, std::abs(v)); }
+    if (maxVal <= 0.0) return;
+    for (std::size_t i = 0; i < vD.size(); ++i) {
+      fMaxDev = std::max(fMaxDev, std::abs(vD[i]-vF[i])/maxVal);
+    }
+  }
+  bool Check() const {
+    const bool isOK = fMaxDev < kTolerance;
+    std::cout << "   " << fName << " : max. relative deviation = " << fMaxDev
+              << (isOK ? "  OK" : "  FAILED") << std::endl;
+    return isOK;
+  }
+};
+
+bool TestElectronData(const G4HepEmData* hepEmData, const G4HepEmElectronData* elData) {
+  // the same data but without the single precision copies
+  G4HepEmElectronData elDataD = *elData;
+  elDataD.fELossDataF32              = nullptr;
+  elDataD.fResMacXSecDataF32         = nullptr;
+  elDataD.fTr1MacXSecDataF32         = nullptr;
+  elDataD.fElemSelectorBremSBDataF32 = nullptr;
+  elDataD.fElemSelectorBremRBDataF32 = nullptr;
+  if (elData->fELossDataF32 == nullptr || elData->fResMacXSecDataF32 == nullptr || elData->fTr1MacXSecDataF32 == nullptr) {
+    std::cerr << " *** Single precision e-/e+ tables were not built" << std::endl;
+    return false;
+  }
+  MaxDeviation devRange{"Range    "}, devDEDX{"DEDX     "}, devInvRange{"InvRange "};
+  MaxDeviation devIoni{"MXSecIoni"}, devBrem{"MXSecBrem"}, devTr1{"TrMFP    "};
+  long numElemSel = 0;
+  long numElemDif = 0;
+  const G4double bremLim = 1.0*GeV;
+  const int numEkin  = 512;
+  const G4double eMin = elData->fELossEnergyGrid[0];
+  const G4double eMax = elData->fELossEnergyGrid[elData->fELossEnergyGridSize-1];
+  const G4HepEmMatCutData* mcData = hepEmData->fTheMatCutData;
+  const G4HepEmMaterialData* matData = hepEmData->fTheMaterialData;
+  for (int imc = 0; imc < mcData->fNumMatCutData; ++imc) {
+    const int imat = mcData->fMatCutData[imc].fHepEmMatIndex;
+    std::vector<G4double> vD[6], vF[6];
+    for (int ie = 0; ie < numEkin; ++ie) {
+      const G4double lekin = std::log(eMin) + ie*std::log(eMax/eMin)/(numEkin-1);
+      const G4double  ekin = std::exp(lekin);
+      const G4double rangeD = G4HepEmElectronManager::GetRestRange(&elDataD, imc, ekin, lekin);
+      vD[0].push_back(rangeD);
+      vF[0].push_back(G4HepEmElectronManager::GetRestRange(elData, imc, ekin, lekin));
+      vD[1].push_back(G4HepEmElectronManager::GetRestDEDX(&elDataD, imc, ekin, lekin));
+      vF[1].push_back(G4HepEmElectronManager::GetRestDEDX(elData, imc, ekin, lekin));
+      vD[2].push_back(G4HepEmElectronManager::GetInvRange(&elDataD, imc, rangeD));
+      vF[2].push_back(G4HepEmElectronManager::GetInvRange(elData, imc, rangeD));
+      vD[3].push_back(G4HepEmElectronManager::GetRestMacXSec(&elDataD, imc, ekin, lekin, true));
+      vF[3].push_back(G4HepEmElectronManager::GetRestMacXSec(elData, imc, ekin, lekin, true));
+      vD[4].push_back(G4HepEmElectronManager::GetRestMacXSec(&elDataD, imc, ekin, lekin, false));
+      vF[4].push_back(G4HepEmElectronManager::GetRestMacXSec(elData, imc, ekin, lekin, false));
+      vD[5].push_back(1.0/G4HepEmElectronManager::GetTransportMFP(&elDataD, imat, ekin, lekin));
+      vF[5].push_back(1.0/G4HepEmElectronManager::GetTransportMFP(elData, imat, ekin, lekin));
+      // target element selection in brem (only for materials with more than one element)
+      if (matData->fMaterialData[imat].fNumOfElement > 1) {
+        const bool isSB = ekin < bremLim;
+        const int  iStart = isSB ? elData->fElemSelectorBremSBStartIndexPerMatCut[imc]
+                                 : elData->fElemSelectorBremRBStartIndexPerMatCut[imc];
+        if (iStart < 0) continue;
+        for (int ir = 0; ir < 100; ++ir) {
+          const G4double urndn = (ir+0.5)/100.0;
+          const int indxD = G4HepEmElectronInteractionBrem::SelectTargetAtom(&elDataD, imc, ekin, lekin, urndn, isSB);
+          const int indxF = G4HepEmElectronInteractionBrem::SelectTargetAtom(elData, imc, ekin, lekin, urndn, isSB);
+          ++numElemSel;
+          if (indxD != indxF) ++numElemDif;
+        }
+      }
+    }
+    devRange.Add(vD[0], vF[0]);
+    devDEDX.Add(vD[1], vF[1]);
+    devInvRange.Add(vD[2], vF[2]);
+    devIoni.Add(vD[3], vF[3]);
+    devBrem.Add(vD[4], vF[4]);
+    devTr1.Add(vD[5], vF[5]);
+  }
+  bool isOK = devRange.Check();
+  isOK = devDEDX.Check() && isOK;
+  isOK = devInvRange.Check() && isOK;
+  isOK = devIoni.Check() && isOK;
+  isOK = devBrem.Check() && isOK;
+  isOK = devTr1.Check() && isOK;
+  const G4double fracDif = numElemSel > 0 ? (G4double)numElemDif/numElemSel : 0.0;
+  std::cout << "   Brem. target elements: fraction of different selections = " << fracDif
+            << (fracDif < kElemTolerance ? "  OK" : "  FAILED") << std::endl;
+  return isOK && fracDif < kElemTolerance;
+}
+
+bool TestGammaData(const G4HepEmData* hepEmData, const G4HepEmGammaData* gmData) {
+  G4HepEmGammaData gmDataD = *gmData;
+  gmDataD.fConvCompMacXsecDataF32  = nullptr;
+  gmDataD.fElemSelectorConvDataF32 = nullptr;
+  if (gmData->fConvCompMacXsecDataF32 == nullptr) {
+    std::cerr << " *** Single precision gamma tables were not built" << std::endl;
+    return false;
+  }
+  MaxDeviation devConv{"MXSecConv"}, devComp{"MXSecComp"};
+  long numElemSel = 0;
+  long numElemDif = 0;
+  const int numEkin  = 512;
+  const G4double eMin = 2.0*CLHEP::electron_mass_c2;
+  const G4double eMax = 100.0*TeV;
+  const G4HepEmMaterialData* matData = hepEmData->fTheMaterialData;
+  for (int imat = 0; imat < gmData->fNumMaterials; ++imat) {
+    std::vector<G4double> vD[2], vF[2];
+    for (int ie = 0; ie < numEkin; ++ie) {
+      const G4double lekin = std::log(eMin) + ie*std::log(eMax/eMin)/(numEkin-1);
+      const G4double  ekin = std::exp(lekin);
+      vD[0].push_back(G4HepEmGammaManager::GetMacXSec(&gmDataD, imat, ekin, lekin, 0));
+      vF[0].push_back(G4HepEmGammaManager::GetMacXSec(gmData, imat, ekin, lekin, 0));
+      vD[1].push_back(G4HepEmGammaManager::GetMacXSec(&gmDataD, imat, ekin, lekin, 1));
+      vF[1].push_back(G4HepEmGammaManager::GetMacXSec(gmData, imat, ekin, lekin, 1));
+      if (matData->fMaterialData[imat].fNumOfElement > 1 && gmData->fElemSelectorConvStartIndexPerMat[imat] > -1) {
+        for (int ir = 0; ir < 100; ++ir) {
+          const G4double urndn = (ir+0.5)/100.0;
+          const int indxD = G4HepEmGammaInteractionConversion::SelectTargetAtom(&gmDataD, imat, ekin, lekin, urndn);
+          const int indxF = G4HepEmGammaInteractionConversion::SelectTargetAtom(gmData, imat, ekin, lekin, urndn);
+          ++numElemSel;
+          if (indxD != indxF) ++numElemDif;
+        }
+      }
+    }
+    devConv.Add(vD[0], vF[0]);
+    devComp.Add(vD[1], vF[1]);
+  }
+  bool isOK = devConv.Check();
+  isOK = devComp.Check() && isOK;
+  const G4double fracDif = numElemSel > 0 ? (G4double)numElemDif/numElemSel : 0.0;
+  std::cout << "   Conv. target elements: fraction of different selections = " << fracDif
+            << (fracDif < kElemTolerance ? "  OK" : "  FAILED") << std::endl;
+  return isOK && fracDif < kElemTolerance;
+}
+
+int main() {
+  // --- Set up a fake G4 geometry with including all pre-defined NIST materials
+  //     to produce the G4MaterialCutsCouple objects.
+  const G4double secProdThreshold = 0.7*mm;
+  FakeG4Setup (secProdThreshold, 0);
+  //
+  // --- Initialise G4HepEm for e-, e+ and gamma with the single precision tables.
+  G4HepEmRunManager* runMgr = new G4HepEmRunManager ( true );
+  runMgr->SetUseFloat32Tables(true);
+  runMgr->Initialize ( new G4HepEmRandomEngine(G4Random::getTheEngine()), 0 );
+  runMgr->Initialize ( new G4HepEmRandomEngine(G4Random::getTheEngine()), 1 );
+  runMgr->Initialize ( new G4HepEmRandomEngine(G4Random::getTheEngine()), 2 );
+  const G4HepEmData* hepEmData = runMgr->GetHepEmData();
+  //
+  std::cout << " === Float32 tables v.s. double precision tables: e-" << std::endl;
+  bool isOK = TestElectronData(hepEmData, hepEmData->fTheElectronData);
+  std::cout << " === Float32 tables v.s. double precision tables: e+" << std::endl;
+  isOK = TestElectronData(hepEmData, hepEmData->fThePositronData) && isOK;
+  std::cout << " === Float32 tables v.s. double precision tables: gamma" << std::endl;
+  isOK = TestGammaData(hepEmData, hepEmData->fTheGammaData) && isOK;
+  if (!isOK) {
+    return 1;
+  }
+  std::cout << " === Float32 tables Test: PASSING \n" << std::endl;
+  return 0;
+}
@@ -46,6 +46,28 @@ void G4HepEmElectronDataTester(G4HepEmElectronData* d) {
   EXPECT_EQ(d->fElemSelectorBremRBNumData, 0);
   EXPECT_EQ(d->fElemSelectorBremRBStartIndexPerMatCut, nullptr);
   EXPECT_EQ(d->fElemSelectorBremRBData, nullptr);
+
+  EXPECT_EQ(d->fUMSCTlimitMinData, nullptr);
+  EXPECT_EQ(d->fUMSCTheta0CorrData, nullptr);
+  EXPECT_EQ(d->fUMSCAngularNumEkin, 0);
+  EXPECT_EQ(d->fUMSCAngularNumTau, 0);
+  EXPECT_EQ(d->fUMSCAngularNumPoints, 0);
+  EXPECT_EQ(d->fUMSCAngularData, nullptr);
+  EXPECT_EQ(d->fBremRBEnvNumEkin, 0);
+  EXPECT_EQ(d->fBremRBEnvNumBins, 0);
+  EXPECT_EQ(d->fBremRBEnvNumData, 0);
+  EXPECT_EQ(d->fBremRBEnvStartIndexPerMatCut, nullptr);
+  EXPECT_EQ(d->fBremRBEnvData, nullptr);
+  EXPECT_EQ(d->fIoniInvCDFNumPoints, 0);
+  EXPECT_EQ(d->fIoniInvCDFNumData, 0);
+  EXPECT_EQ(d->fIoniInvCDFStartIndexPerMatCut, nullptr);
+  EXPECT_EQ(d->fIoniInvCDFData, nullptr);
+
+  EXPECT_EQ(d->fELossDataF32, nullptr);
+  EXPECT_EQ(d->fResMacXSecDataF32, nullptr);
+  EXPECT_EQ(d->fTr1MacXSecDataF32, nullptr);
+  EXPECT_EQ(d->fElemSelectorBremSBDataF32, nullptr);
+  EXPECT_EQ(d->fElemSelectorBremRBDataF32, nullptr);
 }
 
 TEST(G4HepEmElectronData, DefaultConstruction) {
@@ -124,6 +146,29 @@ void G4HepEmGammaDataTester(G4HepEmGammaData* d) {
   EXPECT_EQ(d->fElemSelectorConvStartIndexPerMat, nullptr);
   EXPECT_EQ(d->fElemSelectorConvEgrid, nullptr);
   EXPECT_EQ(d->fElemSelectorConvData, nullptr);
+
+  // Lookup grid has a fixed size, but dynamic allocation
+  EXPECT_EQ(d->fPEEnergyGridSize, 209);
+  EXPECT_EQ(d->fPENumData, 0);
+  EXPECT_EQ(d->fPEStartIndexPerMat, nullptr);
+  EXPECT_EQ(d->fPEBinKnotIndex, nullptr);
+  EXPECT_EQ(d->fPEData, nullptr);
+
+  EXPECT_EQ(d->fFusedEnergyGridSize, 0);
+  EXPECT_EQ(d->fFusedEnergyGrid, nullptr);
+  EXPECT_EQ(d->fFusedMacXsecData, nullptr);
+
+  // Grid has a fixed size, but dynamic allocation
+  EXPECT_EQ(d->fConvLPMGridSize, 501);
+  EXPECT_EQ(d->fConvLPMNumData, 0);
+  EXPECT_EQ(d->fConvLPMStartIndexPerZ, nullptr);
+  EXPECT_EQ(d->fConvLPMData, nullptr);
+
+  EXPECT_EQ(d->fCompInvCDFNumPoints, 0);
+  EXPECT_EQ(d->fCompInvCDFData, nullptr);
+
+  EXPECT_EQ(d->fConvCompMacXsecDataF32, nullptr);
+  EXPECT_EQ(d->fElemSelectorConvDataF32, nullptr);
 }
 
 TEST(G4HepEmGammaData, DefaultConstruction) {
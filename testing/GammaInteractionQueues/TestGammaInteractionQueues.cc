@@ -0,0 +1,197 @@
+// local (and TestUtils) includes
+#include "TestUtils/G4SetUp.hh"
+
+// G4 includes
+#include "globals.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4MaterialCutsCouple.hh"
+#include "Randomize.hh"
+
+// G4HepEm includes
+#include "G4HepEmRunManager.hh"
+#include "G4HepEmRandomEngine.hh"
+#include "G4HepEmData.hh"
+#include "G4HepEmMatCutData.hh"
+#include "G4HepEmParameters.hh"
+#include "G4HepEmTLData.hh"
+#include "G4HepEmElectronTrack.hh"
+#include "G4HepEmGammaTrack.hh"
+#include "G4HepEmGammaManager.hh"
+#include "G4HepEmGammaInteractionQueue.hh"
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// Compares the batched gamma stepping (G4HepEmGammaManager::HowFar and ::Perform
+// over an array of tracks, with the per process SoA interaction queues) to the
+// single track G4HepEmGammaManager::HowFar and ::Perform. The batched Perform
+// runs the conversion, Compton and photoelectric queues one after the other, so
+// the single track Perform is invoked in the same order (on the conversion,
+// then the Compton and then the photoelectric tracks, each in track order),
+// starting from the same seed. The two must then give bit-identical post-step
+// states (kinetic energy, direction, energy deposit, number-of-interaction-left)
+// and secondary e-/e+ (kinetic energy, direction and charge) for all tracks.
+// Some of the tracks are put on boundary (with a shorter step) to check that
+// they are left out of the queues as in the single track case.
+
+// the secondary e-/e+ of a primary
+struct Secondary {
+  G4double fEKin;
+  G4double fDir[3];
+  G4double fCharge;
+};
+
+// the i-th of the `numTracks` primaries: log-uniform energy in [10 keV, 10 GeV]
+// and a direction that changes with the index
+void InitPrimary(G4HepEmGammaTrack* gmTrack, int i, int numTracks, int hepEmIMC) {
+  gmTrack->ReSet();
+  G4HepEmTrack* theTrack = gmTrack->GetTrack();
+  const G4double lMin  = std::log(10.0*keV);
+  const G4double lMax  = std::log(10.0*GeV);
+  const G4double lekin = lMin + (lMax - lMin)*(i + 0.5)/numTracks;
+  theTrack->SetEKin(std::exp(lekin), lekin);
+  theTrack->SetMCIndex(hepEmIMC);
+  theTrack->SetID(i);
+  const G4double cost = 1.0 - 2.0*(i % 17 + 0.5)/17.0;
+  const G4double sint = std::sqrt((1.0 - cost)*(1.0 + cost));
+  const G4double phi  = 0.37*i;
+  theTrack->SetDirection(sint*std::cos(phi), sint*std::sin(phi), cost);
+}
+
+// every 5th track is limited by the geometry at half of its physics step
+void SetGeometryStep(G4HepEmTrack* theTrack, int i) {
+  const bool onBoundary = (i % 5 == 4);
+  theTrack->SetOnBoundary(onBoundary);
+  if (onBoundary) {
+    theTrack->SetGStepLength(0.5*theTrack->GetGStepLength());
+  }
+}
+
+bool IsSameTrack(G4HepEmTrack* a, G4HepEmTrack* b) {
+  bool isSame = a->GetEKin() == b->GetEKin() && a->GetEnergyDeposit() == b->GetEnergyDeposit()
+                && a->GetWinnerProcessIndex() == b->GetWinnerProcessIndex();
+  for (int i = 0; i < 3; ++i) {
+    isSame = isSame && a->GetDirection()[i] == b->GetDirection()[i] && a->GetNumIALeft(i) == b->GetNumIALeft(i);
+  }
+  return isSame;
+}
+
+bool IsSameSecondary(const Secondary& a, const Secondary& b) {
+  return a.fEKin == b.fEKin && a.fDir[0] == b.fDir[0] && a.fDir[1] == b.fDir[1] && a.fDir[2] == b.fDir[2]
+         && a.fCharge == b.fCharge;
+}
+
+bool TestGammaInteractionQueues(G4HepEmData* hepEmData, G4HepEmParameters* hepEmPars, G4HepEmTLData* tlData,
+                                int hepEmIMC, long seed) {
+  const int numTracks = 2000;
+  G4HepEmRandomEngine* rnge = tlData->GetRNGEngine();
+  //
+  // the batched stepping with the interaction queues
+  G4Random::setTheSeed(seed);
+  std::vector<G4HepEmGammaTrack> tracksBatch(numTracks);
+  for (int i = 0; i < numTracks; ++i) {
+    InitPrimary(&tracksBatch[i], i, numTracks, hepEmIMC);
+  }
+  G4HepEmGammaManager::HowFar(hepEmData, hepEmPars, tracksBatch.data(), numTracks, rnge);
+  for (int i = 0; i < numTracks; ++i) {
+    SetGeometryStep(tracksBatch[i].GetTrack(), i);
+  }
+  G4HepEmGammaInteractionQueues queues;
+  G4HepEmGammaManager::Perform(hepEmData, hepEmPars, tracksBatch.data(), numTracks, &queues, rnge);
+  std::vector<std::vector<Secondary>> secBatch(numTracks);
+  const G4HepEmSecondaryQueue& secQueue = queues.fSecondaries;
+  for (int is = 0; is < secQueue.fSize; ++is) {
+    secBatch[secQueue.fParentIndex[is]].push_back(
+      {secQueue.fEKin[is], {secQueue.fDirX[is], secQueue.fDirY[is], secQueue.fDirZ[is]}, secQueue.fCharge[is]});
+  }
+  FreeGammaInteractionQueues(&queues);
+  //
+  // the single track stepping: HowFar in track order then Perform in process order
+  G4Random::setTheSeed(seed);
+  std::vector<G4HepEmGammaTrack> tracksSingle(numTracks);
+  G4HepEmGammaTrack* thePrimary = tlData->GetPrimaryGammaTrack();
+  for (int i = 0; i < numTracks; ++i) {
+    InitPrimary(thePrimary, i, numTracks, hepEmIMC);
+    G4HepEmGammaManager::HowFar(hepEmData, hepEmPars, tlData);
+    SetGeometryStep(thePrimary->GetTrack(), i);
+    tracksSingle[i] = *thePrimary;
+  }
+  std::vector<std::vector<Secondary>> secSingle(numTracks);
+  for (int ip = -1; ip < 3; ++ip) {
+    for (int i = 0; i < numTracks; ++i) {
+      G4HepEmTrack* theTrack = tracksSingle[i].GetTrack();
+      // the tracks on boundary (no interaction queue) first as they use no random numbers
+      const int iQueue = theTrack->GetOnBoundary() ? -1 : theTrack->GetWinnerProcessIndex();
+      if (iQueue != ip) {
+        continue;
+      }
+      *thePrimary = tracksSingle[i];
+      G4HepEmGammaManager::Perform(hepEmData, hepEmPars, tlData);
+      tracksSingle[i] = *thePrimary;
+      for (std::size_t is = 0; is < tlData->GetNumSecondaryElectronTrack(); ++is) {
+        G4HepEmTrack* theSec = tlData->GetSecondaryElectronTrack(is)->GetTrack();
+        const G4double* dir = theSec->GetDirection();
+        secSingle[i].push_back({theSec->GetEKin(), {dir[0], dir[1], dir[2]}, theSec->GetCharge()});
+      }
+      tlData->ResetNumSecondaryElectronTrack();
+    }
+  }
+  //
+  // compare
+  int numDiffTracks = 0;
+  int numDiffSecondaries = 0;
+  int numInteractions[3] = {0, 0, 0};
+  for (int i = 0; i < numTracks; ++i) {
+    if (!IsSameTrack(tracksBatch[i].GetTrack(), tracksSingle[i].GetTrack())) {
+      if (numDiffTracks++ == 0) {
+        std::cout << "   first different primary: index = " << i << " ekin batched = "
+                  << tracksBatch[i].GetTrack()->GetEKin() << " single = " << tracksSingle[i].GetTrack()->GetEKin()
+                  << std::endl;
+      }
+    }
+    bool isSame = secBatch[i].size() == secSingle[i].size();
+    for (std::size_t is = 0; isSame && is < secBatch[i].size(); ++is) {
+      isSame = IsSameSecondary(secBatch[i][is], secSingle[i][is]);
+    }
+    if (!isSame && numDiffSecondaries++ == 0) {
+      std::cout << "   first different secondaries: parent index = " << i << " #batched = " << secBatch[i].size()
+                << " #single = " << secSingle[i].size() << std::endl;
+    }
+    G4HepEmTrack* theTrack = tracksSingle[i].GetTrack();
+    if (!theTrack->GetOnBoundary()) {
+      ++numInteractions[theTrack->GetWinnerProcessIndex()];
+    }
+  }
+  std::cout << "   seed = " << seed << " #conversion = " << numInteractions[0] << " #Compton = " << numInteractions[1]
+            << " #photoelectric = " << numInteractions[2] << " #different primaries = " << numDiffTracks
+            << " #different secondaries = " << numDiffSecondaries << std::endl;
+  return numDiffTracks == 0 && numDiffSecondaries == 0;
+}
+
+int main() {
+  // --- Set up a fake G4 geometry with a single (compound) material to produce
+  //     the G4MaterialCutsCouple object.
+  const G4double secProdThreshold = 0.7*mm;
+  const G4MaterialCutsCouple* couple = FakeG4Setup (secProdThreshold, "G4_PbWO4", 0);
+  //
+  // --- Initialise G4HepEm for gamma.
+  G4HepEmRunManager* runMgr = new G4HepEmRunManager ( true );
+  G4HepEmRandomEngine* rnge = new G4HepEmRandomEngine(G4Random::getTheEngine());
+  runMgr->Initialize ( rnge, 2 );
+  G4HepEmData* hepEmData = runMgr->GetHepEmData();
+  G4HepEmParameters* hepEmPars = runMgr->GetHepEmParameters();
+  G4HepEmTLData* tlData = runMgr->GetTheTLData();
+  const int hepEmIMC = hepEmData->fTheMatCutData->fG4MCIndexToHepEmMCIndex[couple->GetIndex()];
+  //
+  std::cout << " === Batched (interaction queues) v.s. single track gamma stepping" << std::endl;
+  bool isOK = true;
+  for (long seed : {12345L, 67890L, 24680L}) {
+    isOK = TestGammaInteractionQueues(hepEmData, hepEmPars, tlData, hepEmIMC, seed) && isOK;
+  }
+  if (!isOK) {
+    return 1;
+  }
+  std::cout << " === Gamma interaction queues Test: PASSING \n" << std::endl;
+  return 0;
+}
@@ -0,0 +1,124 @@
+// local (and TestUtils) includes
+#include "TestUtils/SamplingComparison.hh"
+
+// G4 includes
+#include "globals.hh"
+#include "G4SystemOfUnits.hh"
+
+// G4HepEm includes
+#include "G4HepEmRunManager.hh"
+#include "G4HepEmRandomEngine.hh"
+#include "G4HepEmData.hh"
+#include "G4HepEmMatCutData.hh"
+#include "G4HepEmElectronData.hh"
+
+#include "G4HepEmElectronInteractionIoni.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// Compares the energy transferred to the secondary electron in the Moller (e-)
+// and Bhabha (e+) interactions sampled from the tabulated inverse CDF
+// (G4HepEmParameters::fUseIoniInvCDFTables) to that sampled by rejection at a
+// set of primary kinetic energies (relative to the cut) for some of the
+// material - cuts couples: both the mean of ln(T/T_c) and the chi2/ndf of the
+// two histograms in ln(T/E) are checked. (The mean of T/E is dominated by the
+// rare, large energy transfers so it is not used.) Both samplings start from
+// fixed seeds (see SamplingComparison.hh) so the test is reproducible. The
+// timing of the two samplings is done by benchmarkIoniInvCDFTables.
+
+// The accepted difference of the <ln(T/T_c)> means: the tables (64 points per
+// primary energy, exact 1/x^2 shape in between) bias the mean by up to
+// kSysToleranceLog (absolute). Beyond this, the difference must be within
+// kNumSigma standard deviations of the difference of the two sample means.
+const G4double kSysToleranceLog = 0.005;
+const G4double kNumSigma        = 5.0;
+// The accepted chi2/ndf of the two histograms: for two samples of the same
+// distribution P(chi2/ndf > 3) ~ 1E-5 (ndf ~ 19), while the table bias alone
+// gave chi2/ndf <= 2.1 with 10 times more samples than here.
+const G4double kToleranceChi2 = 3.0;
+// number of bins of the ln(T/E) histograms
+const int kNumBins = 20;
+// the fixed seeds of the rejection and of the tabulated samplings
+const long kSeedRejection = 12345;
+const long kSeedTable     = 67890;
+
+bool TestIoniInvCDFTables(const G4HepEmData* hepEmData, bool iselectron, G4HepEmRandomEngine* rnge) {
+  const G4HepEmElectronData* elData = iselectron ? hepEmData->fTheElectronData : hepEmData->fThePositronData;
+  if (elData->fIoniInvCDFData == nullptr) {
+    std::cerr << " *** Moller/Bhabha inverse CDF tables were not built" << std::endl;
+    return false;
+  }
+  const int numSamples = 100000;
+  const G4double theEkinPerCuts[] = {2.3, 5.0, 50.0, 1000.0};
+  const int numMatCuts = hepEmData->fTheMatCutData->fNumMatCutData;
+  G4double maxDevLog  = 0.0;
+  G4double maxChi2    = 0.0;
+  for (int imc = 0; imc < numMatCuts; imc += 20) {
+    const G4double elCut = hepEmData->fTheMatCutData->fMatCutData[imc].fSecElProdCutE;
+    for (G4double ekinPerCut : theEkinPerCuts) {
+      const G4double ekin  = ekinPerCut*elCut;
+      const G4double lekin = std::log(ekin);
+      // histograms in ln(T/E) between ln(T_c/E) and ln(T_max/E)
+      const G4double lxmin  = std::log(elCut/ekin);
+      const G4double lxmax  = std::log(iselectron ? 0.5 : 1.0);
+      const G4double invDel = kNumBins/(lxmax - lxmin);
+      G4double histRej[kNumBins]  = {0.0};
+      G4double histTabl[kNumBins] = {0.0};
+      // the rejection sampling
+      SampleMoments logRej;
+      SetSamplingSeed(rnge, kSeedRejection);
+      for (int i = 0; i < numSamples; ++i) {
+        const G4double deltaEkin = iselectron
+                                   ? G4HepEmElectronInteractionIoni::SampleETransferMoller(elCut, ekin, rnge)
+                                   : G4HepEmElectronInteractionIoni::SampleETransferBhabha(elCut, ekin, rnge);
+        logRej.Add(std::log(deltaEkin/elCut));
+        const int ib = std::min(kNumBins - 1, std::max(0, (int)((std::log(deltaEkin/ekin) - lxmin)*invDel)));
+        histRej[ib] += 1.0;
+      }
+      // the tabulated inverse CDF
+      SampleMoments logTabl;
+      SetSamplingSeed(rnge, kSeedTable);
+      for (int i = 0; i < numSamples; ++i) {
+        const G4double deltaEkin = G4HepEmElectronInteractionIoni::SampleETransferTable(elData, imc, elCut, ekin, lekin,
+                                                                                        iselectron, rnge);
+        logTabl.Add(std::log(deltaEkin/elCut));
+        const int ib = std::min(kNumBins - 1, std::max(0, (int)((std::log(deltaEkin/ekin) - lxmin)*invDel)));
+        histTabl[ib] += 1.0;
+      }
+      const G4double chi2   = Chi2PerNDF(histRej, histTabl, kNumBins);
+      const G4double devLog = MeanDeviation(logTabl, logRej, kSysToleranceLog);
+      if (devLog > kNumSigma || chi2 > kToleranceChi2) {
+        std::cout << "   deviation at imc = " << imc << " ekin = " << ekin/MeV << " [MeV] : <ln(T/T_c)> rejection = "
+                  << logRej.Mean() << " tabulated = " << logTabl.Mean() << " (" << devLog << " sigma) chi2/ndf = "
+                  << chi2 << std::endl;
+      }
+      maxDevLog = std::max(maxDevLog, devLog);
+      maxChi2   = std::max(maxChi2, chi2);
+    }
+  }
+  const bool isOK = maxDevLog < kNumSigma && maxChi2 < kToleranceChi2;
+  std::cout << "   max. deviation: <ln(T/T_c)> = " << maxDevLog << " sigma (beyond " << kSysToleranceLog
+            << ") max. chi2/ndf = " << maxChi2 << (isOK ? "  OK" : "  FAILED") << std::endl;
+  return isOK;
+}
+
+int main() {
+  // --- Initialise G4HepEm for e- and e+ with the Moller/Bhabha inverse CDF
+  //     tables (with all pre-defined NIST materials).
+  G4HepEmRunManager* runMgr = new G4HepEmRunManager ( true );
+  runMgr->SetUseIoniInvCDFTables(true);
+  G4HepEmRandomEngine* rnge = InitSamplingComparison(runMgr, {0, 1});
+  const G4HepEmData* hepEmData = runMgr->GetHepEmData();
+  //
+  std::cout << " === Moller inverse CDF tables v.s. rejection sampling: e-" << std::endl;
+  bool isOK = TestIoniInvCDFTables(hepEmData, true, rnge);
+  std::cout << " === Bhabha inverse CDF tables v.s. rejection sampling: e+" << std::endl;
+  isOK = TestIoniInvCDFTables(hepEmData, false, rnge) && isOK;
+  if (!isOK) {
+    return 1;
+  }
+  std::cout << " === Moller/Bhabha inverse CDF tables Test: PASSING \n" << std::endl;
+  return 0;
+}
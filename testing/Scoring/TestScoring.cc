@@ -0,0 +1,139 @@
+// G4 includes
+#include "globals.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4Box.hh"
+#include "G4LogicalVolume.hh"
+#include "G4Material.hh"
+#include "G4NistManager.hh"
+
+// G4HepEm includes
+#include "G4HepEmScoring.hh"
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// Tests the G4HepEmScoring volume IDs and the per-thread accumulation:
+//  - the (logical volume, copy number) pairs are mapped to the assigned volume
+//    IDs, the same copy number of two different logical volumes to different
+//    IDs, and the not assigned pairs to -1 (i.e. not scored);
+//  - the steps, scored concurrently by several threads into their own buffers,
+//    are summed up by Merge to the expected values. All the scored values are
+//    small integers (or halves) so the sums are exact, independently from the
+//    order of the additions, and must agree with the expected ones exactly.
+
+const int kNumLayerCopies = 4;
+const int kNumAbsCopies   = 2;
+const int kNumVolumeIDs   = kNumLayerCopies + kNumAbsCopies;
+const int kNumThreads     = 4;
+const int kNumStepsPerID  = 1000;
+
+// the steps of the thread `ith`: in each volume ID, `kNumStepsPerID` steps of a
+// charged particle (edep = 1 + ith, step length = 0.5) and of a neutral one
+// (edep = 2, step length = 1), plus steps in not scored volumes
+void ScoreSteps(G4HepEmScoring* scoring, int ith, const G4LogicalVolume* lvLayer,
+                const G4LogicalVolume* lvAbs, const G4LogicalVolume* lvWorld) {
+  G4HepEmScoring::Buffer* buffer = scoring->CreateThreadBuffer();
+  for (int is = 0; is < kNumStepsPerID; ++is) {
+    for (int ic = 0; ic < kNumLayerCopies; ++ic) {
+      buffer->Accumulate(scoring->GetVolumeID(lvLayer, ic), 1.0 + ith, 0.5, -1.0);
+      buffer->Accumulate(scoring->GetVolumeID(lvLayer, ic), 2.0, 1.0, 0.0);
+    }
+    for (int ic = 0; ic < kNumAbsCopies; ++ic) {
+      buffer->Accumulate(scoring->GetVolumeID(lvAbs, ic), 1.0 + ith, 0.5, 1.0);
+      buffer->Accumulate(scoring->GetVolumeID(lvAbs, ic), 2.0, 1.0, 0.0);
+    }
+    buffer->Accumulate(scoring->GetVolumeID(lvWorld, 0), 1.0, 1.0, -1.0);
+    buffer->Accumulate(scoring->GetVolumeID(lvAbs, kNumAbsCopies), 1.0, 1.0, -1.0);
+  }
+}
+
+bool TestVolumeIDs(const G4HepEmScoring& scoring, const G4LogicalVolume* lvLayer,
+                   const G4LogicalVolume* lvAbs, const G4LogicalVolume* lvWorld) {
+  bool isOK = true;
+  for (int ic = 0; ic < kNumLayerCopies; ++ic) {
+    isOK = isOK && scoring.GetVolumeID(lvLayer, ic) == ic;
+  }
+  for (int ic = 0; ic < kNumAbsCopies; ++ic) {
+    isOK = isOK && scoring.GetVolumeID(lvAbs, ic) == kNumLayerCopies + ic;
+  }
+  isOK = isOK && scoring.GetVolumeID(lvLayer, 0) != scoring.GetVolumeID(lvAbs, 0);
+  isOK = isOK && scoring.GetVolumeID(lvLayer, -1) == -1 && scoring.GetVolumeID(lvLayer, kNumLayerCopies) == -1;
+  isOK = isOK && scoring.GetVolumeID(lvAbs, kNumAbsCopies) == -1;
+  isOK = isOK && scoring.GetVolumeID(lvWorld, 0) == -1 && scoring.GetVolumeID(nullptr, 0) == -1;
+  if (!isOK) {
+    std::cerr << "\n*** ERROR:\nG4HepEmScoring: wrong volume ID of a (logical volume, copy number) pair"
+              << std::endl;
+  }
+  return isOK;
+}
+
+bool TestMerge(const G4HepEmScoring& scoring, int numRuns) {
+  // the sum of (1 + ith) over the threads
+  const G4double sumThreads = kNumThreads*(kNumThreads + 1)/2;
+  int numErrors = 0;
+  for (int id = 0; id < kNumVolumeIDs; ++id) {
+    const G4double edep   = numRuns*kNumStepsPerID*(sumThreads + 2.0*kNumThreads);
+    const G4double length = numRuns*kNumStepsPerID*0.5*kNumThreads;
+    const long     nSteps = (long)numRuns*kNumStepsPerID*kNumThreads;
+    if (scoring.GetEdep()[id] != edep || scoring.GetChargedTrackLength()[id] != length
+        || scoring.GetNumChargedSteps()[id] != nSteps || scoring.GetNumNeutralSteps()[id] != nSteps) {
+      if (numErrors++ == 0) {
+        std::cerr << "\n*** ERROR:\nG4HepEmScoring: wrong merged results in volume ID = " << id
+                  << " (after " << numRuns << " run(s)) edep = " << scoring.GetEdep()[id] << " (" << edep
+                  << ") charged track length = " << scoring.GetChargedTrackLength()[id] << " (" << length
+                  << ") #charged steps = " << scoring.GetNumChargedSteps()[id] << " (" << nSteps
+                  << ") #neutral steps = " << scoring.GetNumNeutralSteps()[id] << " (" << nSteps << ")"
+                  << std::endl;
+      }
+    }
+  }
+  return numErrors == 0;
+}
+
+int main() {
+  // --- A layer (replicated in the calorimeter), an absorber (placed twice)
+  //     and a world logical volume: only the first two are scored.
+  G4Material* mat = G4NistManager::Instance()->FindOrBuildMaterial("G4_Pb");
+  G4LogicalVolume* lvWorld = new G4LogicalVolume(new G4Box("World", 1.0*m, 1.0*m, 1.0*m), mat, "World");
+  G4LogicalVolume* lvLayer = new G4LogicalVolume(new G4Box("Layer", 1.0*cm, 1.0*m, 1.0*m), mat, "Layer");
+  G4LogicalVolume* lvAbs   = new G4LogicalVolume(new G4Box("Abs", 0.5*cm, 1.0*m, 1.0*m), mat, "Abs");
+  //
+  G4HepEmScoring scoring(kNumVolumeIDs);
+  scoring.SetVolumeIDs(lvLayer, 0, kNumLayerCopies);
+  scoring.SetVolumeIDs(lvAbs, kNumLayerCopies, kNumAbsCopies);
+  if (!TestVolumeIDs(scoring, lvLayer, lvAbs, lvWorld)) {
+    return 1;
+  }
+  //
+  // --- Two "runs" of concurrent scoring: the buffers are reset by the Merge
+  //     of the first so the second run must double the results. The second
+  //     run creates new thread buffers (as new workers would do).
+  for (int irun = 1; irun <= 2; ++irun) {
+    std::vector<std::thread> workers;
+    for (int ith = 0; ith < kNumThreads; ++ith) {
+      workers.emplace_back(ScoreSteps, &scoring, ith, lvLayer, lvAbs, lvWorld);
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+    scoring.Merge();
+    if (!TestMerge(scoring, irun)) {
+      return 1;
+    }
+  }
+  // a further Merge without any scoring mustn't change the results
+  scoring.Merge();
+  if (!TestMerge(scoring, 2)) {
+    return 1;
+  }
+  scoring.Reset();
+  for (int id = 0; id < kNumVolumeIDs; ++id) {
+    if (scoring.GetEdep()[id] != 0.0 || scoring.GetNumChargedSteps()[id] != 0) {
+      std::cerr << "\n*** ERROR:\nG4HepEmScoring: results are not reset" << std::endl;
+      return 1;
+    }
+  }
+  std::cout << " === Scoring Test: PASSING \n" << std::endl;
+  return 0;
+}
@@ -48,11 +48,21 @@ bool operator==(const G4HepEmParameters& lhs, const G4HepEmParameters& rhs)
   return std::tie(lhs.fElectronTrackingCut, lhs.fMinLossTableEnergy,
                   lhs.fMaxLossTableEnergy, lhs.fNumLossTableBins,
                   lhs.fFinalRange, lhs.fDRoverRange, lhs.fLinELossLimit,
-                  lhs.fElectronBremModelLim) ==
+                  lhs.fElectronBremModelLim, lhs.fGammaXSecTableLayout,
+                  lhs.fNumGammaFusedTableBinsPerDecade,
+                  lhs.fUseLPMFunctionTables, lhs.fUseFloat32Tables,
+                  lhs.fUseUMSCAngularTables, lhs.fUseUMSCCorrectionTables,
+                  lhs.fUseRBBremEnvelopeTables,
+                  lhs.fUseIoniInvCDFTables, lhs.fUseCompInvCDFTables) ==
          std::tie(rhs.fElectronTrackingCut, rhs.fMinLossTableEnergy,
                   rhs.fMaxLossTableEnergy, rhs.fNumLossTableBins,
                   rhs.fFinalRange, rhs.fDRoverRange, rhs.fLinELossLimit,
-                  rhs.fElectronBremModelLim);
+                  rhs.fElectronBremModelLim, rhs.fGammaXSecTableLayout,
+                  rhs.fNumGammaFusedTableBinsPerDecade,
+                  rhs.fUseLPMFunctionTables, rhs.fUseFloat32Tables,
+                  rhs.fUseUMSCAngularTables, rhs.fUseUMSCCorrectionTables,
+                  rhs.fUseRBBremEnvelopeTables,
+                  rhs.fUseIoniInvCDFTables, rhs.fUseCompInvCDFTables);
 }
 
 bool operator!=(const G4HepEmParameters& lhs, const G4HepEmParameters& rhs)
@@ -65,10 +75,14 @@ bool operator==(const G4HepEmElemData& lhs, const G4HepEmElemData& rhs)
 {
   if(std::tie(lhs.fZet, lhs.fZet13, lhs.fZet23, lhs.fCoulomb, lhs.fLogZ,
               lhs.fZFactor1, lhs.fDeltaMaxLow, lhs.fDeltaMaxHigh,
-              lhs.fILVarS1, lhs.fILVarS1Cond, lhs.fKShellBindingEnergy) !=
+              lhs.fILVarS1, lhs.fILVarS1Cond, lhs.fKShellBindingEnergy,
+              lhs.fDeltaFactorBH, lhs.fFZBH[0], lhs.fFZBH[1],
+              lhs.fInvDeltaMaxBH[0], lhs.fInvDeltaMaxBH[1]) !=
      std::tie(rhs.fZet, rhs.fZet13, rhs.fZet23, rhs.fCoulomb, rhs.fLogZ,
               rhs.fZFactor1, rhs.fDeltaMaxLow, rhs.fDeltaMaxHigh,
-              rhs.fILVarS1, rhs.fILVarS1Cond, rhs.fKShellBindingEnergy))
+              rhs.fILVarS1, rhs.fILVarS1Cond, rhs.fKShellBindingEnergy,
+              rhs.fDeltaFactorBH, rhs.fFZBH[0], rhs.fFZBH[1],
+              rhs.fInvDeltaMaxBH[0], rhs.fInvDeltaMaxBH[1]))
   {
     return false;
   }
@@ -347,6 +361,112 @@ bool operator==(const G4HepEmGammaData& lhs, const G4HepEmGammaData& rhs)
     return false;
   }
 
+  // photoelectric data
+  if(std::tie(lhs.fPELogMinEkin, lhs.fPEEILDelta) !=
+     std::tie(rhs.fPELogMinEkin, rhs.fPEEILDelta))
+  {
+    return false;
+  }
+
+  const int lhsPENumMat = lhs.fPENumData > 0 ? lhs.fNumMaterials : 0;
+  const int rhsPENumMat = rhs.fPENumData > 0 ? rhs.fNumMaterials : 0;
+  if(!compare_arrays(lhsPENumMat, lhs.fPEStartIndexPerMat, rhsPENumMat,
+                     rhs.fPEStartIndexPerMat))
+  {
+    return false;
+  }
+
+  if(!compare_arrays(lhsPENumMat * (lhs.fPEEnergyGridSize - 1),
+                     lhs.fPEBinKnotIndex,
+                     rhsPENumMat * (rhs.fPEEnergyGridSize - 1),
+                     rhs.fPEBinKnotIndex))
+  {
+    return false;
+  }
+
+  if(!compare_arrays(lhs.fPENumData, lhs.fPEData, rhs.fPENumData, rhs.fPEData))
+  {
+    return false;
+  }
+
+  // fused macroscopic cross section data
+  if(std::tie(lhs.fFusedLogMinEkin, lhs.fFusedEILDelta) !=
+     std::tie(rhs.fFusedLogMinEkin, rhs.fFusedEILDelta))
+  {
+    return false;
+  }
+
+  if(!compare_arrays(lhs.fFusedEnergyGridSize, lhs.fFusedEnergyGrid,
+                     rhs.fFusedEnergyGridSize, rhs.fFusedEnergyGrid))
+  {
+    return false;
+  }
+
+  if(!compare_arrays(lhs.fNumMaterials * lhs.fFusedEnergyGridSize * 4,
+                     lhs.fFusedMacXsecData,
+                     rhs.fNumMaterials * rhs.fFusedEnergyGridSize * 4,
+                     rhs.fFusedMacXsecData))
+  {
+    return false;
+  }
+
+  // conversion LPM function tables
+  if(std::tie(lhs.fConvLPMLogMinVar, lhs.fConvLPMILDelta) !=
+     std::tie(rhs.fConvLPMLogMinVar, rhs.fConvLPMILDelta))
+  {
+    return false;
+  }
+
+  const int lhsLPMNumZet =
+    lhs.fConvLPMNumData > 0 ? lhs.fConvLPMMaxZet + 1 : 0;
+  const int rhsLPMNumZet =
+    rhs.fConvLPMNumData > 0 ? rhs.fConvLPMMaxZet + 1 : 0;
+  if(!compare_arrays(lhsLPMNumZet, lhs.fConvLPMStartIndexPerZ, rhsLPMNumZet,
+                     rhs.fConvLPMStartIndexPerZ))
+  {
+    return false;
+  }
+
+  if(!compare_arrays(lhs.fConvLPMNumData, lhs.fConvLPMData,
+                     rhs.fConvLPMNumData, rhs.fConvLPMData))
+  {
+    return false;
+  }
+
+  // Klein-Nishina inverse CDF tables for Compton
+  if(lhs.fCompInvCDFNumPoints != rhs.fCompInvCDFNumPoints)
+  {
+    return false;
+  }
+
+  if(!compare_arrays(
+       lhs.fCompInvCDFData != nullptr
+         ? lhs.fCompEnergyGridSize * lhs.fCompInvCDFNumPoints
+         : 0,
+       lhs.fCompInvCDFData,
+       rhs.fCompInvCDFData != nullptr
+         ? rhs.fCompEnergyGridSize * rhs.fCompInvCDFNumPoints
+         : 0,
+       rhs.fCompInvCDFData))
+  {
+    return false;
+  }
+
+  // single precision copies of the tables
+  if(!compare_arrays(lhsXsecSize, lhs.fConvCompMacXsecDataF32, rhsXsecSize,
+                     rhs.fConvCompMacXsecDataF32))
+  {
+    return false;
+  }
+
+  if(!compare_arrays(lhs.fElemSelectorConvNumData,
+                     lhs.fElemSelectorConvDataF32,
+                     rhs.fElemSelectorConvNumData,
+                     rhs.fElemSelectorConvDataF32))
+  {
+    return false;
+  }
+
   return true;
 }
 
@@ -432,6 +552,109 @@ bool operator==(const G4HepEmElectronData& lhs, const G4HepEmElectronData& rhs)
     return false;
   }
 
+  // Urban msc step limit and theta0 correction data
+  const int lhsUMSCDataSize = 2 * lhs.fELossEnergyGridSize * lhs.fNumMaterials;
+  const int rhsUMSCDataSize = 2 * rhs.fELossEnergyGridSize * rhs.fNumMaterials;
+  if(!compare_arrays(lhsUMSCDataSize, lhs.fUMSCTlimitMinData, rhsUMSCDataSize,
+                     rhs.fUMSCTlimitMinData))
+  {
+    return false;
+  }
+  if(!compare_arrays(lhsUMSCDataSize, lhs.fUMSCTheta0CorrData, rhsUMSCDataSize,
+                     rhs.fUMSCTheta0CorrData))
+  {
+    return false;
+  }
+  if(std::tie(lhs.fUMSCAngularNumEkin, lhs.fUMSCAngularLogMinEkin,
+              lhs.fUMSCAngularEILDelta, lhs.fUMSCAngularNumTau,
+              lhs.fUMSCAngularLogMinTau, lhs.fUMSCAngularTauILDelta,
+              lhs.fUMSCAngularNumPoints) !=
+     std::tie(rhs.fUMSCAngularNumEkin, rhs.fUMSCAngularLogMinEkin,
+              rhs.fUMSCAngularEILDelta, rhs.fUMSCAngularNumTau,
+              rhs.fUMSCAngularLogMinTau, rhs.fUMSCAngularTauILDelta,
+              rhs.fUMSCAngularNumPoints))
+  {
+    return false;
+  }
+  const int lhsUMSCAngularDataSize =
+    lhs.fNumMaterials * lhs.fUMSCAngularNumEkin * lhs.fUMSCAngularNumTau * lhs.fUMSCAngularNumPoints;
+  const int rhsUMSCAngularDataSize =
+    rhs.fNumMaterials * rhs.fUMSCAngularNumEkin * rhs.fUMSCAngularNumTau * rhs.fUMSCAngularNumPoints;
+  if(!compare_arrays(lhsUMSCAngularDataSize, lhs.fUMSCAngularData,
+                     rhsUMSCAngularDataSize, rhs.fUMSCAngularData))
+  {
+    return false;
+  }
+  if(std::tie(lhs.fBremRBEnvNumEkin, lhs.fBremRBEnvLogMinEkin,
+              lhs.fBremRBEnvEILDelta, lhs.fBremRBEnvNumBins,
+              lhs.fBremRBEnvNumData) !=
+     std::tie(rhs.fBremRBEnvNumEkin, rhs.fBremRBEnvLogMinEkin,
+              rhs.fBremRBEnvEILDelta, rhs.fBremRBEnvNumBins,
+              rhs.fBremRBEnvNumData))
+  {
+    return false;
+  }
+  if(!compare_arrays(lhs.fBremRBEnvStartIndexPerMatCut != nullptr ? lhs.fNumMatCuts : 0,
+                     lhs.fBremRBEnvStartIndexPerMatCut,
+                     rhs.fBremRBEnvStartIndexPerMatCut != nullptr ? rhs.fNumMatCuts : 0,
+                     rhs.fBremRBEnvStartIndexPerMatCut))
+  {
+    return false;
+  }
+  if(!compare_arrays(lhs.fBremRBEnvData != nullptr ? lhs.fBremRBEnvNumData : 0, lhs.fBremRBEnvData,
+                     rhs.fBremRBEnvData != nullptr ? rhs.fBremRBEnvNumData : 0, rhs.fBremRBEnvData))
+  {
+    return false;
+  }
+  if(std::tie(lhs.fIoniInvCDFNumPoints, lhs.fIoniInvCDFNumData) !=
+     std::tie(rhs.fIoniInvCDFNumPoints, rhs.fIoniInvCDFNumData))
+  {
+    return false;
+  }
+  if(!compare_arrays(lhs.fIoniInvCDFStartIndexPerMatCut != nullptr ? lhs.fNumMatCuts : 0,
+                     lhs.fIoniInvCDFStartIndexPerMatCut,
+                     rhs.fIoniInvCDFStartIndexPerMatCut != nullptr ? rhs.fNumMatCuts : 0,
+                     rhs.fIoniInvCDFStartIndexPerMatCut))
+  {
+    return false;
+  }
+  if(!compare_arrays(lhs.fIoniInvCDFData != nullptr ? lhs.fIoniInvCDFNumData : 0, lhs.fIoniInvCDFData,
+                     rhs.fIoniInvCDFData != nullptr ? rhs.fIoniInvCDFNumData : 0, rhs.fIoniInvCDFData))
+  {
+    return false;
+  }
+
+  // single precision copies of the tables
+  if(!compare_arrays(lhsELossDataSize, lhs.fELossDataF32, rhsELossDataSize,
+                     rhs.fELossDataF32))
+  {
+    return false;
+  }
+  if(!compare_arrays(lhs.fResMacXSecNumData, lhs.fResMacXSecDataF32,
+                     rhs.fResMacXSecNumData, rhs.fResMacXSecDataF32))
+  {
+    return false;
+  }
+  const int lhsTr1DataSize = 2 * lhs.fELossEnergyGridSize * lhs.fNumMaterials;
+  const int rhsTr1DataSize = 2 * rhs.fELossEnergyGridSize * rhs.fNumMaterials;
+  if(!compare_arrays(lhsTr1DataSize, lhs.fTr1MacXSecDataF32, rhsTr1DataSize,
+                     rhs.fTr1MacXSecDataF32))
+  {
+    return false;
+  }
+  if(!compare_arrays(
+       lhs.fElemSelectorBremSBNumData, lhs.fElemSelectorBremSBDataF32,
+       rhs.fElemSelectorBremSBNumData, rhs.fElemSelectorBremSBDataF32))
+  {
+    return false;
+  }
+  if(!compare_arrays(
+       lhs.fElemSelectorBremRBNumData, lhs.fElemSelectorBremRBDataF32,
+       rhs.fElemSelectorBremRBNumData, rhs.fElemSelectorBremRBDataF32))
+  {
+    return false;
+  }
+
   return true;
 }
 
@@ -0,0 +1,96 @@
+#ifndef SAMPLINGCOMPARISON_HH
+#define SAMPLINGCOMPARISON_HH
+
+// local (and TestUtils) includes
+#include "G4SetUp.hh"
+
+// G4 includes
+#include "globals.hh"
+#include "G4SystemOfUnits.hh"
+#include "Randomize.hh"
+
+// G4HepEm includes
+#include "G4HepEmRunManager.hh"
+#include "G4HepEmRandomEngine.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+
+/**
+ * @file    SamplingComparison.hh
+ *
+ * Common set up and simple statistics for the tests (and benchmarks) that
+ * compare a tabulated sampling of an interaction to the reference (rejection
+ * or analytic) sampling.
+ *
+ * Each comparison is done with fixed seeds: the reference and the tabulated
+ * samplings are started from two different (fixed) seeds, so the two samples
+ * are independent while the outcome of the test is reproducible.
+ */
+
+// Builds the fake Geant4 geometry with all pre-defined NIST materials (0.7 mm
+// secondary production threshold) and initialises the given G4HepEm run manager
+// for the listed particles (0: e-, 1: e+, 2: gamma). The options of the run
+// manager (e.g. the optional tables) must be set before. Returns the random
+// engine used for the initialisation and the sampling.
+inline G4HepEmRandomEngine* InitSamplingComparison(G4HepEmRunManager* runMgr, std::initializer_list<int> particles) {
+  const G4double secProdThreshold = 0.7*mm;
+  FakeG4Setup (secProdThreshold, 0);
+  G4HepEmRandomEngine* rnge = new G4HepEmRandomEngine(G4Random::getTheEngine());
+  for (int ipart : particles) {
+    runMgr->Initialize ( rnge, ipart );
+  }
+  return rnge;
+}
+
+// Re-seeds the random engine (and drops the cached Gaussian random number).
+inline void SetSamplingSeed(G4HepEmRandomEngine* rnge, long seed) {
+  G4Random::setTheSeed(seed);
+  rnge->DiscardGauss();
+}
+
+// The number of samples, the mean and the variance of the mean of a sampled quantity.
+struct SampleMoments {
+  void Add(G4double x) { ++fNum; fSum += x; fSum2 += x*x; }
+
+  G4double Mean() const { return fNum > 0 ? fSum/fNum : 0.0; }
+  G4double VarianceOfMean() const {
+    if (fNum < 2) {
+      return 0.0;
+    }
+    const G4double mean = Mean();
+    return std::max(0.0, fSum2/fNum - mean*mean)/(fNum - 1);
+  }
+
+  long     fNum  = 0;
+  G4double fSum  = 0.0;
+  G4double fSum2 = 0.0;
+};
+
+// The difference of the means of two independent samples in units of its
+// standard deviation after subtracting the accepted (systematic) absolute
+// difference `sysTolerance`: the two are compatible if it is below the number
+// of standard deviations accepted by the test.
+inline G4double MeanDeviation(const SampleMoments& a, const SampleMoments& b, G4double sysTolerance) {
+  const G4double diff  = std::max(0.0, std::abs(a.Mean() - b.Mean()) - sysTolerance);
+  const G4double sigma = std::sqrt(a.VarianceOfMean() + b.VarianceOfMean());
+  return sigma > 0.0 ? diff/sigma : (diff > 0.0 ? 1.0E+30 : 0.0);
+}
+
+// The chi2/ndf of two histograms, with the same binning and number of entries,
+// over the bins with any entries (ndf is the number of these bins minus one).
+inline G4double Chi2PerNDF(const G4double* histA, const G4double* histB, int numBins) {
+  G4double chi2      = 0.0;
+  int      numFilled = 0;
+  for (int ib = 0; ib < numBins; ++ib) {
+    const G4double sum = histA[ib] + histB[ib];
+    if (sum > 0.0) {
+      chi2 += (histA[ib] - histB[ib])*(histA[ib] - histB[ib])/sum;
+      ++numFilled;
+    }
+  }
+  return numFilled > 1 ? chi2/(numFilled - 1) : 0.0;
+}
+
+#endif // SAMPLINGCOMPARISON_HH
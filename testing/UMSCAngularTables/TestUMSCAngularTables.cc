@@ -0,0 +1,115 @@
+// local (and TestUtils) includes
+#include "TestUtils/SamplingComparison.hh"
+
+// G4 includes
+#include "globals.hh"
+#include "G4SystemOfUnits.hh"
+
+// G4HepEm includes
+#include "G4HepEmRunManager.hh"
+#include "G4HepEmRandomEngine.hh"
+#include "G4HepEmParameters.hh"
+#include "G4HepEmData.hh"
+#include "G4HepEmMaterialData.hh"
+#include "G4HepEmElectronData.hh"
+
+#include "G4HepEmElectronManager.hh"
+#include "G4HepEmElectronInteractionUMSC.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// Compares the mean of 1-cos(theta) of the Urban msc angular distribution
+// sampled from the tabulated distributions (G4HepEmParameters::fUseUMSCAngularTables)
+// to the one sampled by using the analytic model at a set of kinetic energies and
+// step lengths (in first transport mfp) for a few materials. Both samplings start
+// from fixed seeds (see SamplingComparison.hh) so the test is reproducible. The
+// timing of the two samplings is done by benchmarkUMSCAngularTables.
+
+// The accepted difference of the means: the tables approximate the distribution
+// by 64 quantiles, interpolated in ln(tau), which biases the mean by up to
+// kSysTolerance (relative). Beyond this, the difference must be within
+// kNumSigma standard deviations of the difference of the two sample means.
+const G4double kSysTolerance = 0.02;
+const G4double kNumSigma     = 5.0;
+// the fixed seeds of the analytic and of the tabulated samplings
+const long kSeedAnalytic = 12345;
+const long kSeedTable    = 67890;
+
+bool TestUMSCAngularTables(const G4HepEmData* hepEmData, const G4HepEmElectronData* elData, G4HepEmRandomEngine* rnge) {
+  if (elData->fUMSCAngularData == nullptr) {
+    std::cerr << " *** Urban msc angular distribution tables were not built" << std::endl;
+    return false;
+  }
+  const int numSamples = 200000;
+  const G4double theEkins[] = {10.0*keV, 1.0*MeV, 100.0*MeV, 10.0*GeV};
+  const G4double theTaus[]  = {0.01, 0.1, 1.0};
+  const G4HepEmMaterialData* matData = hepEmData->fTheMaterialData;
+  const int numMaterials = std::min(matData->fNumMaterialData, 5);
+  G4double maxDev      = 0.0;
+  long     numFallback = 0;
+  for (int imat = 0; imat < numMaterials; ++imat) {
+    const G4HepEmMatData& mData = matData->fMaterialData[imat];
+    for (G4double ekin : theEkins) {
+      const G4double lekin     = std::log(ekin);
+      const G4double lambdaTr1 = G4HepEmElectronManager::GetTransportMFP(elData, imat, ekin, lekin);
+      const G4double theta0Corr = elData == hepEmData->fTheElectronData
+                                  ? 1.0 : G4HepEmElectronInteractionUMSC::Theta0PositronCorrection(ekin*ekin, mData.fZeff);
+      for (G4double tau : theTaus) {
+        const G4double step = tau*lambdaTr1;
+        // the analytic sampling (without energy loss and not extremely small step)
+        SampleMoments anal;
+        SetSamplingSeed(rnge, kSeedAnalytic);
+        for (int i = 0; i < numSamples; ++i) {
+          anal.Add(1.0 - G4HepEmElectronInteractionUMSC::SampleCosineTheta(step, ekin, lambdaTr1, ekin, lambdaTr1, 0.0,
+                         mData.fRadiationLength, theta0Corr, mData.fUMSCTailCoeff, mData.fUMSCThetaCoeff, rnge));
+        }
+        // the tabulated sampling (the analytic is used if the tables cannot be)
+        SampleMoments tabl;
+        SetSamplingSeed(rnge, kSeedTable);
+        const G4double ltau = std::log(tau);
+        for (int i = 0; i < numSamples; ++i) {
+          G4double cost = 1.0;
+          if (!G4HepEmElectronInteractionUMSC::SampleCosineThetaTable(elData, imat, lekin, tau, ltau, cost, rnge)) {
+            cost = G4HepEmElectronInteractionUMSC::SampleCosineTheta(step, ekin, lambdaTr1, ekin, lambdaTr1, 0.0,
+                   mData.fRadiationLength, theta0Corr, mData.fUMSCTailCoeff, mData.fUMSCThetaCoeff, rnge);
+            ++numFallback;
+          }
+          tabl.Add(1.0 - cost);
+        }
+        const G4double dev = MeanDeviation(tabl, anal, kSysTolerance*anal.Mean());
+        if (dev > kNumSigma) {
+          std::cout << "   deviation = " << dev << " sigma at imat = " << imat << " ekin = " << ekin/MeV
+                    << " [MeV] tau = " << tau << " : <1-cos> analytic = " << anal.Mean()
+                    << " tabulated = " << tabl.Mean() << std::endl;
+        }
+        maxDev = std::max(maxDev, dev);
+      }
+    }
+  }
+  const long numAll = (long)numMaterials*numSamples*(sizeof(theEkins)/sizeof(G4double))*(sizeof(theTaus)/sizeof(G4double));
+  std::cout << "   <1-cos(theta)> : max. deviation beyond the " << kSysTolerance << " relative tolerance = " << maxDev
+            << " sigma" << (maxDev < kNumSigma ? "  OK" : "  FAILED") << " (fraction of fallbacks to the analytic = "
+            << (G4double)numFallback/numAll << ")" << std::endl;
+  return maxDev < kNumSigma;
+}
+
+int main() {
+  // --- Initialise G4HepEm for e- and e+ with the Urban msc angular tables
+  //     (with all pre-defined NIST materials).
+  G4HepEmRunManager* runMgr = new G4HepEmRunManager ( true );
+  runMgr->SetUseUMSCAngularTables(true);
+  G4HepEmRandomEngine* rnge = InitSamplingComparison(runMgr, {0, 1});
+  const G4HepEmData* hepEmData = runMgr->GetHepEmData();
+  //
+  std::cout << " === Urban msc angular tables v.s. analytic sampling: e-" << std::endl;
+  bool isOK = TestUMSCAngularTables(hepEmData, hepEmData->fTheElectronData, rnge);
+  std::cout << " === Urban msc angular tables v.s. analytic sampling: e+" << std::endl;
+  isOK = TestUMSCAngularTables(hepEmData, hepEmData->fThePositronData, rnge) && isOK;
+  if (!isOK) {
+    return 1;
+  }
+  std::cout << " === Urban msc angular tables Test: PASSING \n" << std::endl;
+  return 0;
+}
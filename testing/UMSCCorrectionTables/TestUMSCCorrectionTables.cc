@@ -0,0 +1,125 @@
+// local (and TestUtils) includes
+#include "TestUtils/G4SetUp.hh"
+
+// G4 includes
+#include "globals.hh"
+#include "G4SystemOfUnits.hh"
+#include "Randomize.hh"
+
+// G4HepEm includes
+#include "G4HepEmRunManager.hh"
+#include "G4HepEmRandomEngine.hh"
+#include "G4HepEmParameters.hh"
+#include "G4HepEmParametersInit.hh"
+#include "G4HepEmData.hh"
+#include "G4HepEmMaterialData.hh"
+#include "G4HepEmElectronData.hh"
+
+#include "G4HepEmElectronInteractionUMSC.hh"
+#include "G4HepEmRunUtils.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// Checks that the analytic Urban msc minimum step limit and e+ theta0 correction
+// factors are used by default and compares their tabulated values
+// (G4HepEmParameters::fUseUMSCCorrectionTables) to the analytic ones on a fine
+// kinetic energy grid over the whole table range for all materials.
+
+// the accepted relative deviation of the minimum step limit factor: the spline
+// is exact above 5 keV and deviates at most 1.5 % near this low energy kink
+const G4double kToleranceTlimitMin  = 0.02;
+// the accepted relative deviation of the e+ theta0 correction: at most 0.4 %
+// at the lowest (100 eV) and 0.2 % around 100 keV, below 1E-4 above 10 MeV
+const G4double kToleranceTheta0Corr = 0.005;
+
+bool TestUMSCCorrectionTables(const G4HepEmData* hepEmData, bool iselectron) {
+  const G4HepEmElectronData* elData = iselectron ? hepEmData->fTheElectronData : hepEmData->fThePositronData;
+  if (elData->fUMSCTlimitMinData == nullptr || (!iselectron && elData->fUMSCTheta0CorrData == nullptr)) {
+    std::cerr << " *** Urban msc correction tables were not built" << std::endl;
+    return false;
+  }
+  const int      numEkin = elData->fELossEnergyGridSize;
+  G4double*      theGrid = elData->fELossEnergyGrid;
+  const G4double lminE   = std::log(theGrid[0]);
+  const G4double lmaxE   = std::log(theGrid[numEkin-1]);
+  // 100 test points per table bin (none of them on the grid)
+  const int    numPoints = 100*(numEkin-1);
+  const G4HepEmMaterialData* matData = hepEmData->fTheMaterialData;
+  G4double maxDevTlimitMin  = 0.0;
+  G4double maxDevTheta0Corr = 0.0;
+  for (int imat = 0; imat < matData->fNumMaterialData; ++imat) {
+    const G4HepEmMatData& mData = matData->fMaterialData[imat];
+    G4double* tlimitMinData  = &(elData->fUMSCTlimitMinData[2*numEkin*imat]);
+    G4double* theta0CorrData = iselectron ? nullptr : &(elData->fUMSCTheta0CorrData[2*numEkin*imat]);
+    for (int i = 0; i < numPoints; ++i) {
+      const G4double lekin = lminE + (i + 0.5)*(lmaxE - lminE)/numPoints;
+      const G4double ekin  = std::exp(lekin);
+      // the minimum step limit factor (its inverse is tabulated)
+      const G4double tlimitMinTabl = 1.0/GetSplineLog(numEkin, theGrid, tlimitMinData, ekin, lekin,
+                                                      elData->fELossLogMinEkin, elData->fELossEILDelta);
+      const G4double tlimitMinAnal = G4HepEmElectronInteractionUMSC::ComputeTlimitMinFactor(ekin, mData.fZeff23,
+                                       mData.fZeffSqrt, mData.fUMSCStepMinPars, iselectron);
+      const G4double devTlimitMin  = std::abs(tlimitMinTabl/tlimitMinAnal - 1.0);
+      if (devTlimitMin > kToleranceTlimitMin) {
+        std::cout << "   tlimitmin factor deviation = " << devTlimitMin << " at imat = " << imat
+                  << " ekin = " << ekin/keV << " [keV]" << std::endl;
+      }
+      maxDevTlimitMin = std::max(maxDevTlimitMin, devTlimitMin);
+      if (iselectron) {
+        continue;
+      }
+      // the e+ theta0 correction
+      const G4double theta0CorrTabl = GetSplineLog(numEkin, theGrid, theta0CorrData, ekin, lekin,
+                                                   elData->fELossLogMinEkin, elData->fELossEILDelta);
+      const G4double theta0CorrAnal = G4HepEmElectronInteractionUMSC::Theta0PositronCorrection(ekin*ekin, mData.fZeff);
+      const G4double devTheta0Corr  = std::abs(theta0CorrTabl/theta0CorrAnal - 1.0);
+      if (devTheta0Corr > kToleranceTheta0Corr) {
+        std::cout << "   theta0 correction deviation = " << devTheta0Corr << " at imat = " << imat
+                  << " ekin = " << ekin/keV << " [keV]" << std::endl;
+      }
+      maxDevTheta0Corr = std::max(maxDevTheta0Corr, devTheta0Corr);
+    }
+  }
+  std::cout << "   tlimitmin factor  : max. relative deviation = " << maxDevTlimitMin
+            << (maxDevTlimitMin < kToleranceTlimitMin ? "  OK" : "  FAILED") << std::endl;
+  if (!iselectron) {
+    std::cout << "   theta0 correction : max. relative deviation = " << maxDevTheta0Corr
+              << (maxDevTheta0Corr < kToleranceTheta0Corr ? "  OK" : "  FAILED") << std::endl;
+  }
+  return maxDevTlimitMin < kToleranceTlimitMin && maxDevTheta0Corr < kToleranceTheta0Corr;
+}
+
+int main() {
+  // --- Set up a fake G4 geometry with including all pre-defined NIST materials
+  //     to produce the G4MaterialCutsCouple objects.
+  const G4double secProdThreshold = 0.7*mm;
+  FakeG4Setup (secProdThreshold, 0);
+  //
+  // --- The analytic factors are used by default.
+  G4HepEmParameters defaultPars;
+  InitHepEmParameters(&defaultPars);
+  if (defaultPars.fUseUMSCCorrectionTables) {
+    std::cerr << " *** Urban msc correction tables are used by default" << std::endl;
+    return 1;
+  }
+  //
+  // --- Initialise G4HepEm for e- and e+ with the Urban msc correction tables.
+  G4HepEmRunManager* runMgr = new G4HepEmRunManager ( true );
+  runMgr->SetUseUMSCCorrectionTables(true);
+  G4HepEmRandomEngine* rnge = new G4HepEmRandomEngine(G4Random::getTheEngine());
+  runMgr->Initialize ( rnge, 0 );
+  runMgr->Initialize ( rnge, 1 );
+  const G4HepEmData* hepEmData = runMgr->GetHepEmData();
+  //
+  std::cout << " === Urban msc correction tables v.s. analytic factors: e-" << std::endl;
+  bool isOK = TestUMSCCorrectionTables(hepEmData, true);
+  std::cout << " === Urban msc correction tables v.s. analytic factors: e+" << std::endl;
+  isOK = TestUMSCCorrectionTables(hepEmData, false) && isOK;
+  if (!isOK) {
+    return 1;
+  }
+  std::cout << " === Urban msc correction tables Test: PASSING \n" << std::endl;
+  return 0;
+}
@@ -0,0 +1,77 @@
+// local (and TestUtils) includes
+#include "TestUtils/SamplingComparison.hh"
+
+// G4 includes
+#include "globals.hh"
+#include "G4SystemOfUnits.hh"
+
+// G4HepEm includes
+#include "G4HepEmRunManager.hh"
+#include "G4HepEmRandomEngine.hh"
+#include "G4HepEmData.hh"
+#include "G4HepEmMatCutData.hh"
+#include "G4HepEmElectronData.hh"
+
+#include "G4HepEmElectronInteractionBrem.hh"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+// Reports the average time of sampling one photon energy of the relativistic
+// bremsstrahlung model with the analytic rejection and with the tabulated
+// rejection envelopes (G4HepEmParameters::fUseRBBremEnvelopeTables) at each
+// kinetic energy of TestBremRBEnvelope (averaged over its material - cuts
+// couples) for e-.
+//
+// Usage: benchmarkBremRBEnvelope [number-of-samples-per-configuration]
+
+int main(int argc, char *argv[]) {
+  const int numSamples = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  G4HepEmRunManager* runMgr = new G4HepEmRunManager ( true );
+  runMgr->SetUseRBBremEnvelopeTables(true);
+  G4HepEmRandomEngine* rnge = InitSamplingComparison(runMgr, {0});
+  G4HepEmData* hepEmData = runMgr->GetHepEmData();
+  G4HepEmElectronData* elData = hepEmData->fTheElectronData;
+  if (elData->fBremRBEnvData == nullptr) {
+    std::cerr << " *** relativistic brem rejection envelopes were not built" << std::endl;
+    return 1;
+  }
+  //
+  const G4double theEkins[] = {2.0*GeV, 30.0*GeV, 1.0*TeV, 50.0*TeV};
+  const int numMatCuts = hepEmData->fTheMatCutData->fNumMatCutData;
+  G4double* envData = elData->fBremRBEnvData;
+  // the sum of the sampled values is printed so the sampling cannot be optimised away
+  G4double sum = 0.0;
+  std::cout << " === Relativistic brem sampling: time per sample (" << numSamples << " samples per configuration)"
+            << std::endl;
+  for (G4double ekin : theEkins) {
+    const G4double lekin = std::log(ekin);
+    G4double timeAnal = 0.0;
+    G4double timeEnv  = 0.0;
+    long     numAll   = 0;
+    for (int imc = 0; imc < numMatCuts; imc += 20) {
+      SetSamplingSeed(rnge, 12345);
+      elData->fBremRBEnvData = nullptr;
+      auto t0 = std::chrono::steady_clock::now();
+      for (int i = 0; i < numSamples; ++i) {
+        sum += G4HepEmElectronInteractionBrem::SampleETransferRB(hepEmData, ekin, lekin, imc, rnge, true);
+      }
+      auto t1 = std::chrono::steady_clock::now();
+      elData->fBremRBEnvData = envData;
+      auto t2 = std::chrono::steady_clock::now();
+      for (int i = 0; i < numSamples; ++i) {
+        sum += G4HepEmElectronInteractionBrem::SampleETransferRB(hepEmData, ekin, lekin, imc, rnge, true);
+      }
+      auto t3 = std::chrono::steady_clock::now();
+      timeAnal += std::chrono::duration<G4double, std::nano>(t1 - t0).count();
+      timeEnv  += std::chrono::duration<G4double, std::nano>(t3 - t2).count();
+      numAll   += numSamples;
+    }
+    std::cout << "   ekin = " << ekin/GeV << " [GeV] : analytic = " << timeAnal/numAll << " [ns] envelope = "
+              << timeEnv/numAll << " [ns]" << std::endl;
+  }
+  std::cout << "   (sum of the samples = " << sum << ")" << std::endl;
+  return 0;
+}
@@ -0,0 +1,65 @@
+// local (and TestUtils) includes
+#include "TestUtils/SamplingComparison.hh"
+
+// G4 includes
+#include "globals.hh"
+#include "G4SystemOfUnits.hh"
+
+// G4HepEm includes
+#include "G4HepEmRunManager.hh"
+#include "G4HepEmRandomEngine.hh"
+#include "G4HepEmData.hh"
+#include "G4HepEmGammaData.hh"
+
+#include "G4HepEmGammaInteractionCompton.hh"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+// Reports the average time of sampling one post interaction photon in Compton
+// scattering by rejection and from the Klein-Nishina inverse CDF tables
+// (G4HepEmParameters::fUseCompInvCDFTables) at each primary photon energy of
+// TestCompInvCDFTables.
+//
+// Usage: benchmarkCompInvCDFTables [number-of-samples-per-configuration]
+
+int main(int argc, char *argv[]) {
+  const int numSamples = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  G4HepEmRunManager* runMgr = new G4HepEmRunManager ( true );
+  runMgr->SetUseCompInvCDFTables(true);
+  G4HepEmRandomEngine* rnge = InitSamplingComparison(runMgr, {2});
+  const G4HepEmGammaData* gmData = runMgr->GetHepEmData()->fTheGammaData;
+  if (gmData->fCompInvCDFData == nullptr) {
+    std::cerr << " *** Compton inverse CDF tables were not built" << std::endl;
+    return 1;
+  }
+  //
+  const G4double theEkins[] = {150.0*eV, 1.0*keV, 12.3*keV, 100.0*keV, 511.0*keV, 1.7*MeV, 33.0*MeV, 1.0*GeV,
+                               100.0*GeV, 70.0*TeV};
+  const G4double theOrgDir[3] = {0.0, 0.0, 1.0};
+  G4double theDir[3];
+  // the sum of the sampled values is printed so the sampling cannot be optimised away
+  G4double sum = 0.0;
+  std::cout << " === Compton sampling: time per sample (" << numSamples << " samples per energy)" << std::endl;
+  for (G4double ekin : theEkins) {
+    const G4double lekin = std::log(ekin);
+    SetSamplingSeed(rnge, 12345);
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < numSamples; ++i) {
+      sum += G4HepEmGammaInteractionCompton::SamplePhotonEnergyAndDirection(ekin, theDir, theOrgDir, rnge) + theDir[2];
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int i = 0; i < numSamples; ++i) {
+      sum += G4HepEmGammaInteractionCompton::SamplePhotonEnergyAndDirectionTable(gmData, ekin, lekin, theDir, theOrgDir,
+                                                                                 rnge) + theDir[2];
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    std::cout << "   ekin = " << ekin/MeV << " [MeV] : rejection = "
+              << std::chrono::duration<G4double, std::nano>(t1 - t0).count()/numSamples << " [ns] tabulated = "
+              << std::chrono::duration<G4double, std::nano>(t2 - t1).count()/numSamples << " [ns]" << std::endl;
+  }
+  std::cout << "   (sum of the samples = " << sum << ")" << std::endl;
+  return 0;
+}
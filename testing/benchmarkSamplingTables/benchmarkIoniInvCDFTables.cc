@@ -0,0 +1,79 @@
+// local (and TestUtils) includes
+#include "TestUtils/SamplingComparison.hh"
+
+// G4 includes
+#include "globals.hh"
+#include "G4SystemOfUnits.hh"
+
+// G4HepEm includes
+#include "G4HepEmRunManager.hh"
+#include "G4HepEmRandomEngine.hh"
+#include "G4HepEmData.hh"
+#include "G4HepEmMatCutData.hh"
+#include "G4HepEmElectronData.hh"
+
+#include "G4HepEmElectronInteractionIoni.hh"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+// Reports the average time of sampling one Moller (e-) and Bhabha (e+) energy
+// transfer by rejection and from the tabulated inverse CDF
+// (G4HepEmParameters::fUseIoniInvCDFTables) at each primary kinetic energy
+// (relative to the cut) of TestIoniInvCDFTables (averaged over its material -
+// cuts couples).
+//
+// Usage: benchmarkIoniInvCDFTables [number-of-samples-per-configuration]
+
+int main(int argc, char *argv[]) {
+  const int numSamples = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  G4HepEmRunManager* runMgr = new G4HepEmRunManager ( true );
+  runMgr->SetUseIoniInvCDFTables(true);
+  G4HepEmRandomEngine* rnge = InitSamplingComparison(runMgr, {0, 1});
+  const G4HepEmData* hepEmData = runMgr->GetHepEmData();
+  //
+  const G4double theEkinPerCuts[] = {2.3, 5.0, 50.0, 1000.0};
+  const int numMatCuts = hepEmData->fTheMatCutData->fNumMatCutData;
+  // the sum of the sampled values is printed so the sampling cannot be optimised away
+  G4double sum = 0.0;
+  for (bool iselectron : {true, false}) {
+    const G4HepEmElectronData* elData = iselectron ? hepEmData->fTheElectronData : hepEmData->fThePositronData;
+    if (elData->fIoniInvCDFData == nullptr) {
+      std::cerr << " *** Moller/Bhabha inverse CDF tables were not built" << std::endl;
+      return 1;
+    }
+    std::cout << " === " << (iselectron ? "Moller" : "Bhabha") << " sampling: time per sample (" << numSamples
+              << " samples per configuration)" << std::endl;
+    for (G4double ekinPerCut : theEkinPerCuts) {
+      G4double timeRej  = 0.0;
+      G4double timeTabl = 0.0;
+      long     numAll   = 0;
+      for (int imc = 0; imc < numMatCuts; imc += 20) {
+        const G4double elCut = hepEmData->fTheMatCutData->fMatCutData[imc].fSecElProdCutE;
+        const G4double ekin  = ekinPerCut*elCut;
+        const G4double lekin = std::log(ekin);
+        SetSamplingSeed(rnge, 12345);
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < numSamples; ++i) {
+          sum += iselectron
+                 ? G4HepEmElectronInteractionIoni::SampleETransferMoller(elCut, ekin, rnge)
+                 : G4HepEmElectronInteractionIoni::SampleETransferBhabha(elCut, ekin, rnge);
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        for (int i = 0; i < numSamples; ++i) {
+          sum += G4HepEmElectronInteractionIoni::SampleETransferTable(elData, imc, elCut, ekin, lekin, iselectron, rnge);
+        }
+        auto t2 = std::chrono::steady_clock::now();
+        timeRej  += std::chrono::duration<G4double, std::nano>(t1 - t0).count();
+        timeTabl += std::chrono::duration<G4double, std::nano>(t2 - t1).count();
+        numAll   += numSamples;
+      }
+      std::cout << "   ekin/cut = " << ekinPerCut << " : rejection = " << timeRej/numAll << " [ns] tabulated = "
+                << timeTabl/numAll << " [ns]" << std::endl;
+    }
+  }
+  std::cout << "   (sum of the samples = " << sum << ")" << std::endl;
+  return 0;
+}
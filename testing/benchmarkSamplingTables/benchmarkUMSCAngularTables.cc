@@ -0,0 +1,88 @@
+// local (and TestUtils) includes
+#include "TestUtils/SamplingComparison.hh"
+
+// G4 includes
+#include "globals.hh"
+#include "G4SystemOfUnits.hh"
+
+// G4HepEm includes
+#include "G4HepEmRunManager.hh"
+#include "G4HepEmRandomEngine.hh"
+#include "G4HepEmData.hh"
+#include "G4HepEmMaterialData.hh"
+#include "G4HepEmElectronData.hh"
+
+#include "G4HepEmElectronManager.hh"
+#include "G4HepEmElectronInteractionUMSC.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+// Reports the average time of sampling one Urban msc angle by using the analytic
+// model and the tabulated distributions (G4HepEmParameters::fUseUMSCAngularTables)
+// at each kinetic energy of TestUMSCAngularTables (averaged over its step lengths
+// and materials) for e-.
+//
+// Usage: benchmarkUMSCAngularTables [number-of-samples-per-configuration]
+
+int main(int argc, char *argv[]) {
+  const int numSamples = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  G4HepEmRunManager* runMgr = new G4HepEmRunManager ( true );
+  runMgr->SetUseUMSCAngularTables(true);
+  G4HepEmRandomEngine* rnge = InitSamplingComparison(runMgr, {0});
+  const G4HepEmData* hepEmData = runMgr->GetHepEmData();
+  const G4HepEmElectronData* elData = hepEmData->fTheElectronData;
+  if (elData->fUMSCAngularData == nullptr) {
+    std::cerr << " *** Urban msc angular distribution tables were not built" << std::endl;
+    return 1;
+  }
+  //
+  const G4double theEkins[] = {10.0*keV, 1.0*MeV, 100.0*MeV, 10.0*GeV};
+  const G4double theTaus[]  = {0.01, 0.1, 1.0};
+  const G4HepEmMaterialData* matData = hepEmData->fTheMaterialData;
+  const int numMaterials = std::min(matData->fNumMaterialData, 5);
+  // the sum of the sampled values is printed so the sampling cannot be optimised away
+  G4double sum = 0.0;
+  std::cout << " === Urban msc angular sampling: time per sample (" << numSamples << " samples per configuration)"
+            << std::endl;
+  for (G4double ekin : theEkins) {
+    const G4double lekin = std::log(ekin);
+    G4double timeAnal = 0.0;
+    G4double timeTabl = 0.0;
+    long     numAll   = 0;
+    for (int imat = 0; imat < numMaterials; ++imat) {
+      const G4HepEmMatData& mData = matData->fMaterialData[imat];
+      const G4double lambdaTr1 = G4HepEmElectronManager::GetTransportMFP(elData, imat, ekin, lekin);
+      for (G4double tau : theTaus) {
+        const G4double step = tau*lambdaTr1;
+        const G4double ltau = std::log(tau);
+        SetSamplingSeed(rnge, 12345);
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < numSamples; ++i) {
+          sum += G4HepEmElectronInteractionUMSC::SampleCosineTheta(step, ekin, lambdaTr1, ekin, lambdaTr1, 0.0,
+                 mData.fRadiationLength, 1.0, mData.fUMSCTailCoeff, mData.fUMSCThetaCoeff, rnge);
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        for (int i = 0; i < numSamples; ++i) {
+          G4double cost = 1.0;
+          if (!G4HepEmElectronInteractionUMSC::SampleCosineThetaTable(elData, imat, lekin, tau, ltau, cost, rnge)) {
+            cost = G4HepEmElectronInteractionUMSC::SampleCosineTheta(step, ekin, lambdaTr1, ekin, lambdaTr1, 0.0,
+                   mData.fRadiationLength, 1.0, mData.fUMSCTailCoeff, mData.fUMSCThetaCoeff, rnge);
+          }
+          sum += cost;
+        }
+        auto t2 = std::chrono::steady_clock::now();
+        timeAnal += std::chrono::duration<G4double, std::nano>(t1 - t0).count();
+        timeTabl += std::chrono::duration<G4double, std::nano>(t2 - t1).count();
+        numAll   += numSamples;
+      }
+    }
+    std::cout << "   ekin = " << ekin/MeV << " [MeV] : analytic = " << timeAnal/numAll << " [ns] tabulated = "
+              << timeTabl/numAll << " [ns]" << std::endl;
+  }
+  std::cout << "   (sum of the samples = " << sum << ")" << std::endl;
+  return 0;
+}